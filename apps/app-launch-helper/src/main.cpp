@@ -3,13 +3,22 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "common/constant.h"
+#include "common/launchhelperprotocol.h"
 #include "types.h"
 #include "variantValue.h"
 #include <algorithm>
 #include <array>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <memory>
 #include <optional>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <systemd/sd-event.h>
+#include <unistd.h>
 #include <unordered_map>
 #include <vector>
 
@@ -446,10 +455,238 @@ int process_dbus_message(sd_bus *bus)
     return ret;
 }
 
+// Serves the launch requests of application manager until it closes the socket, see launchhelperprotocol.h.
+// Units are started asynchronously on one connection, so requests are pipelined instead of waiting for each other.
+class LaunchServer
+{
+public:
+    LaunchServer(bus_ptr bus, int fd)
+        : m_bus(bus)
+        , m_fd(fd)
+        , m_buffer(LaunchHelperProtocol::MaxRequestSize)
+    {
+    }
+
+    static int onRequest(sd_event_source *source, [[maybe_unused]] int fd, uint32_t revents, void *userdata)
+    {
+        auto *server = reinterpret_cast<LaunchServer *>(userdata);
+        if (!server->readRequests() || (revents & (EPOLLHUP | EPOLLERR)) != 0) {
+            return sd_event_exit(sd_event_source_get_event(source), 0);
+        }
+        return 0;
+    }
+
+    static int onJobRemoved(sd_bus_message *m, void *userdata, [[maybe_unused]] sd_bus_error *ret_error)
+    {
+        const char *job{nullptr};
+        const char *jobResult{nullptr};
+        if (const auto ret = sd_bus_message_read(m, "uoss", nullptr, &job, nullptr, &jobResult); ret < 0) {
+            sd_journal_perror("read from JobRemoved failed.");
+            return 0;
+        }
+
+        // every job of the session is removed through this signal, only the ones started here are looked up.
+        auto *server = reinterpret_cast<LaunchServer *>(userdata);
+        if (auto it = server->m_jobs.find(job); it != server->m_jobs.end()) {
+            server->reply(it->second, jobResult);
+            server->m_jobs.erase(it);
+        }
+        return 0;
+    }
+
+private:
+    struct Call
+    {
+        LaunchServer *server;
+        std::string id;
+    };
+
+    static int onStarted(sd_bus_message *m, void *userdata, [[maybe_unused]] sd_bus_error *ret_error)
+    {
+        std::unique_ptr<Call> call{reinterpret_cast<Call *>(userdata)};
+        if (sd_bus_message_is_method_error(m, nullptr) != 0) {
+            const auto *error = sd_bus_message_get_error(m);
+            sd_journal_print(LOG_ERR, "failed to call StartTransientUnit: [%s,%s]", error->name, error->message);
+            call->server->reply(call->id, "failed");
+            return 0;
+        }
+
+        const char *job{nullptr};
+        if (const auto ret = sd_bus_message_read(m, "o", &job); ret < 0) {
+            sd_journal_perror("failed to parse response message.");
+            call->server->reply(call->id, "internalError");
+            return 0;
+        }
+
+        // the reply of StartTransientUnit always arrives before the JobRemoved of its job.
+        call->server->m_jobs.emplace(job, std::move(call->id));
+        return 0;
+    }
+
+    bool readRequests()
+    {
+        while (true) {
+            const auto len = ::recv(m_fd, m_buffer.data(), m_buffer.size(), MSG_TRUNC);
+            if (len == -1 && errno == EINTR) {
+                continue;
+            }
+
+            if (len == -1) {
+                if (errno == EAGAIN) {
+                    return true;
+                }
+                sd_journal_print(LOG_ERR, "read launch request failed: %s", strerror(errno));
+                return false;
+            }
+
+            if (len == 0) {  // application manager is gone.
+                return false;
+            }
+
+            handleRequest(static_cast<std::size_t>(len));
+        }
+    }
+
+    void handleRequest(std::size_t len)
+    {
+        const std::string_view packet{m_buffer.data(), std::min(len, m_buffer.size())};
+        const auto idEnd = packet.find('\0');
+        if (idEnd == std::string_view::npos || idEnd == 0) {
+            sd_journal_print(LOG_WARNING, "drop malformed launch request.");
+            return;
+        }
+
+        const std::string id{packet.substr(0, idEnd)};
+        if (len > m_buffer.size() || packet.back() != '\0') {
+            sd_journal_print(LOG_WARNING, "launch request %s is too large.", id.c_str());
+            reply(id, "invalidInput");
+            return;
+        }
+
+        // every field is followed by a NUL, so the views can be handed to sd-bus as C strings.
+        std::vector<std::string_view> args;
+        for (auto begin = idEnd + 1; begin < packet.size();) {
+            const auto end = packet.find('\0', begin);
+            args.emplace_back(packet.substr(begin, end - begin));
+            begin = end + 1;
+        }
+
+        msg_ptr msg{nullptr};
+        if (const auto ret = sd_bus_message_new_method_call(
+                m_bus, &msg, SystemdService, SystemdObjectPath, SystemdInterfaceName, "StartTransientUnit");
+            ret < 0) {
+            sd_journal_perror("Failed to create D-Bus call message");
+            reply(id, "internalError");
+            return;
+        }
+
+        const auto serviceId = cmdParse(msg, args);
+        if (!serviceId || *serviceId == "invalidInput") {
+            sd_bus_message_unref(msg);
+            reply(id, serviceId ? "invalidInput" : "internalError");
+            return;
+        }
+
+        auto *call = new Call{this, id};
+        if (const auto ret = sd_bus_call_async(m_bus, nullptr, msg, onStarted, call, 0); ret < 0) {
+            sd_journal_perror("failed to call StartTransientUnit.");
+            delete call;
+            reply(id, "internalError");
+        } else {
+            sd_journal_print(LOG_INFO, "request %s: starting %s", id.c_str(), serviceId->c_str());
+        }
+        sd_bus_message_unref(msg);
+    }
+
+    void reply(std::string_view id, std::string_view result)
+    {
+        std::string packet;
+        packet.reserve(id.size() + result.size() + 2);
+        packet.append(id).append(1, '\0').append(result).append(1, '\0');
+        if (::send(m_fd, packet.data(), packet.size(), MSG_NOSIGNAL) == -1) {
+            sd_journal_print(LOG_ERR, "send result of request %s failed: %s", std::string{id}.c_str(), strerror(errno));
+        }
+    }
+
+    bus_ptr m_bus;
+    int m_fd;
+    std::vector<char> m_buffer;
+    // object path of job -> id of request.
+    std::unordered_map<std::string, std::string> m_jobs;
+};
+
+int runServer(int fd)
+{
+    sd_bus_error error{SD_BUS_ERROR_NULL};
+    sd_bus *bus{nullptr};
+    sd_event *event{nullptr};
+    auto release = [&](ExitCode code) {
+        sd_bus_error_free(&error);
+        sd_bus_flush_close_unref(bus);
+        sd_event_unref(event);
+        return static_cast<int>(code);
+    };
+
+    int ret{0};
+    if (ret = sd_bus_open_user(&bus); ret < 0) {
+        sd_journal_perror("Failed to connect to user bus.");
+        return release(ExitCode::InternalError);
+    }
+
+    if (ret = sd_event_default(&event); ret < 0) {
+        sd_journal_perror("Failed to create event loop.");
+        return release(ExitCode::InternalError);
+    }
+
+    if (ret = sd_bus_attach_event(bus, event, SD_EVENT_PRIORITY_NORMAL); ret < 0) {
+        sd_journal_perror("Failed to attach bus to event loop.");
+        return release(ExitCode::InternalError);
+    }
+
+    // systemd only emits JobRemoved while someone is subscribed.
+    if (ret = sd_bus_call_method(
+            bus, SystemdService, SystemdObjectPath, SystemdInterfaceName, "Subscribe", &error, nullptr, nullptr);
+        ret < 0) {
+        sd_journal_print(LOG_ERR, "failed to subscribe to systemd: [%s,%s]", error.name, error.message);
+        return release(ExitCode::InternalError);
+    }
+
+    LaunchServer server{bus, fd};
+    if (ret = sd_bus_match_signal(bus,
+                                  nullptr,
+                                  SystemdService,
+                                  SystemdObjectPath,
+                                  SystemdInterfaceName,
+                                  "JobRemoved",
+                                  LaunchServer::onJobRemoved,
+                                  &server);
+        ret < 0) {
+        sd_journal_perror("add signal matcher failed.");
+        return release(ExitCode::InternalError);
+    }
+
+    if (ret = sd_event_add_io(event, nullptr, fd, EPOLLIN, LaunchServer::onRequest, &server); ret < 0) {
+        sd_journal_perror("watch launch requests failed.");
+        return release(ExitCode::InternalError);
+    }
+
+    sd_journal_print(LOG_INFO, "app-launch-helper is serving launch requests.");
+    if (ret = sd_event_loop(event); ret < 0) {
+        sd_journal_print(LOG_ERR, "event loop error: %s", strerror(-ret));
+        return release(ExitCode::InternalError);
+    }
+
+    return release(ExitCode::Done);
+}
+
 }  // namespace
 
 int main(int argc, const char *argv[])
 {
+    if (argc == 2 && std::string_view{argv[1]} == LaunchHelperProtocol::ServerOption) {
+        return runServer(STDIN_FILENO);
+    }
+
     sd_bus_error error{SD_BUS_ERROR_NULL};
     sd_bus_message *msg{nullptr};
     sd_bus *bus{nullptr};
@@ -7,6 +7,7 @@
 
 #include <DConfig>
 #include <QDBusConnection>
+#include <QDBusError>
 #include <QDBusMetaType>
 
 DCORE_USE_NAMESPACE
@@ -56,10 +57,41 @@ ObjectMap getManagedObjects()
 
     return qdbus_cast<ObjectMap>(arguments.first());
 }
+
+// only fetches the IDs, the whole object tree carries every property and translation of every application.
+std::optional<QStringList> listApplicationIds()
+{
+    registerComplexDbusType();
+
+    using namespace Qt::StringLiterals;
+    auto msg = QDBusMessage::createMethodCall(fromStaticRaw(DDEApplicationManager1ServiceName),
+                                              fromStaticRaw(DDEApplicationManager1ObjectPath),
+                                              fromStaticRaw(ApplicationManager1Interface),
+                                              u"ListApplications"_s);
+    msg << QStringList{} << QVariantMap{} << 0U << 0U;
+
+    auto reply = QDBusConnection::sessionBus().call(msg);
+    if (reply.type() != QDBusMessage::ReplyMessage) {
+        // older application managers don't provide it.
+        if (reply.errorName() == QDBusError::errorString(QDBusError::UnknownMethod)) {
+            return std::nullopt;
+        }
+        qFatal() << "Failed to list applications" << reply.errorMessage();
+    }
+
+    const auto &arguments = reply.arguments();
+    Q_ASSERT_X(!arguments.isEmpty(), "", "Incorrect reply argument for ListApplications call.");
+
+    return qdbus_cast<ObjectInterfaceMap>(arguments.first()).keys();
+}
 }  // namespace
 
 DExpected<QStringList> Launcher::appIds()
 {
+    if (auto ids = listApplicationIds(); ids) {
+        return std::move(ids).value();
+    }
+
     QStringList appIds;
     const auto objects = getManagedObjects();
     for (auto iter = objects.cbegin(); iter != objects.cend(); ++iter) {
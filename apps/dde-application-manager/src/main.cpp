@@ -30,6 +30,8 @@ void registerComplexDbusType()
     qDBusRegisterMetaType<QList<SystemdProperty>>();
     qDBusRegisterMetaType<SystemdAux>();
     qDBusRegisterMetaType<QList<SystemdAux>>();
+    qDBusRegisterMetaType<ObjectChange>();
+    qDBusRegisterMetaType<ObjectChangeList>();
 }
 }  // namespace
 
@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DDEAMREGISTRY_H
+#define DDEAMREGISTRY_H
+
+#include "common/registryformat.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+// Reader of the application registry published by dde-application-manager.
+// The snapshot is mapped read-only and every accessor returns views into the mapping, nothing is copied.
+// It only depends on libc, so it can be dropped into clients which don't use Qt.
+namespace DDEAM {
+
+class Registry
+{
+public:
+    class Application
+    {
+    public:
+        [[nodiscard]] std::string_view id() const noexcept { return m_registry->string(m_record->id); }
+        [[nodiscard]] std::string_view objectPath() const noexcept { return m_registry->string(m_record->objectPath); }
+        [[nodiscard]] std::string_view name() const noexcept { return m_registry->string(m_record->name); }
+        [[nodiscard]] std::string_view genericName() const noexcept { return m_registry->string(m_record->genericName); }
+        [[nodiscard]] std::string_view icon() const noexcept { return m_registry->string(m_record->icon); }
+        // separated by ';'.
+        [[nodiscard]] std::string_view categories() const noexcept { return m_registry->string(m_record->categories); }
+        [[nodiscard]] std::string_view exec() const noexcept { return m_registry->string(m_record->exec); }
+        [[nodiscard]] bool noDisplay() const noexcept { return (m_record->flags & RegistryFormat::NoDisplay) != 0; }
+        [[nodiscard]] bool terminal() const noexcept { return (m_record->flags & RegistryFormat::Terminal) != 0; }
+
+    private:
+        friend class Registry;
+        Application(const Registry *registry, const RegistryFormat::Record *record) noexcept
+            : m_registry(registry)
+            , m_record(record)
+        {
+        }
+
+        const Registry *m_registry;
+        const RegistryFormat::Record *m_record;
+    };
+
+    Registry(const Registry &) = delete;
+    Registry &operator=(const Registry &) = delete;
+    Registry(Registry &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+    {
+    }
+    Registry &operator=(Registry &&other) noexcept
+    {
+        if (this != &other) {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+    ~Registry() { unmap(); }
+
+    [[nodiscard]] static std::string defaultPath()
+    {
+        const char *runtimeDir = std::getenv("XDG_RUNTIME_DIR");
+        if (runtimeDir == nullptr || *runtimeDir == '\0') {
+            return {};
+        }
+        return std::string{runtimeDir} + '/' + RegistryFormat::FileName;
+    }
+
+    // Maps the snapshot at path, std::nullopt if it doesn't exist or isn't a valid snapshot.
+    // The mapping keeps the snapshot which was current when it was opened, open it again on RegistrySnapshotChanged.
+    [[nodiscard]] static std::optional<Registry> open(const std::string &path = defaultPath())
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            return std::nullopt;
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) == -1 || st.st_size < static_cast<off_t>(sizeof(RegistryFormat::Header))) {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void *data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            return std::nullopt;
+        }
+
+        Registry ret{static_cast<const char *>(data), size};
+        if (!ret.validate()) {
+            return std::nullopt;
+        }
+        return ret;
+    }
+
+    [[nodiscard]] uint64_t generation() const noexcept { return header()->generation; }
+    [[nodiscard]] std::string_view locale() const noexcept { return string(header()->locale); }
+    [[nodiscard]] std::size_t size() const noexcept { return header()->recordCount; }
+    [[nodiscard]] Application at(std::size_t index) const noexcept { return Application{this, records() + index}; }
+
+    // binary search, applications are sorted by ID.
+    [[nodiscard]] std::optional<Application> find(std::string_view id) const noexcept
+    {
+        const auto *begin = records();
+        const auto *end = begin + size();
+        const auto *it = std::lower_bound(
+            begin, end, id, [this](const RegistryFormat::Record &record, std::string_view key) { return string(record.id) < key; });
+        if (it == end || string(it->id) != id) {
+            return std::nullopt;
+        }
+        return Application{this, it};
+    }
+
+private:
+    Registry(const char *data, std::size_t size) noexcept
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    void unmap() noexcept
+    {
+        if (m_data != nullptr) {
+            ::munmap(const_cast<char *>(m_data), m_size);  // NOLINT
+            m_data = nullptr;
+        }
+    }
+
+    [[nodiscard]] const RegistryFormat::Header *header() const noexcept
+    {
+        return reinterpret_cast<const RegistryFormat::Header *>(m_data);  // NOLINT
+    }
+
+    [[nodiscard]] const RegistryFormat::Record *records() const noexcept
+    {
+        return reinterpret_cast<const RegistryFormat::Record *>(m_data + header()->recordsOffset);  // NOLINT
+    }
+
+    [[nodiscard]] std::string_view string(RegistryFormat::StringRef ref) const noexcept
+    {
+        return {m_data + header()->stringsOffset + ref.offset, ref.size};
+    }
+
+    // every offset is checked once here, so the accessors don't have to.
+    [[nodiscard]] bool validate() const noexcept
+    {
+        const auto *h = header();
+        if (std::memcmp(h->magic, RegistryFormat::Magic, sizeof(h->magic)) != 0 || h->version != RegistryFormat::Version ||
+            h->recordSize != sizeof(RegistryFormat::Record) || h->recordsOffset % alignof(RegistryFormat::Record) != 0) {
+            return false;
+        }
+
+        const auto recordsEnd = h->recordsOffset + uint64_t{h->recordCount} * sizeof(RegistryFormat::Record);
+        if (h->recordsOffset < sizeof(RegistryFormat::Header) || recordsEnd > m_size || h->stringsOffset < recordsEnd ||
+            h->stringsOffset > m_size || h->stringsSize > m_size - h->stringsOffset) {
+            return false;
+        }
+
+        auto valid = [h](RegistryFormat::StringRef ref) {
+            return uint64_t{ref.offset} + ref.size < h->stringsSize;
+        };
+        if (!valid(h->locale)) {
+            return false;
+        }
+
+        const auto *begin = records();
+        return std::all_of(begin, begin + h->recordCount, [&valid](const RegistryFormat::Record &record) {
+            return valid(record.id) && valid(record.objectPath) && valid(record.name) && valid(record.genericName) &&
+                   valid(record.icon) && valid(record.categories) && valid(record.exec);
+        });
+    }
+
+    const char *m_data{nullptr};
+    std::size_t m_size{0};
+};
+
+}  // namespace DDEAM
+
+#endif
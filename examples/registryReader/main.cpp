@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "ddeamregistry.h"
+#include <cstdio>
+
+// Usage: registryReader [app-id]
+// Lists every application in the registry, or prints the one with the given ID.
+int main(int argc, char *argv[])
+{
+    auto registry = DDEAM::Registry::open();
+    if (!registry) {
+        std::fprintf(stderr, "couldn't open the application registry at %s\n", DDEAM::Registry::defaultPath().c_str());
+        return 1;
+    }
+
+    auto print = [](const DDEAM::Registry::Application &app) {
+        std::printf("%.*s\t%.*s\t%.*s%s\n",
+                    static_cast<int>(app.id().size()),
+                    app.id().data(),
+                    static_cast<int>(app.name().size()),
+                    app.name().data(),
+                    static_cast<int>(app.exec().size()),
+                    app.exec().data(),
+                    app.noDisplay() ? "\t(NoDisplay)" : "");
+    };
+
+    if (argc > 1) {
+        const auto app = registry->find(argv[1]);
+        if (!app) {
+            std::fprintf(stderr, "%s isn't in the registry\n", argv[1]);
+            return 1;
+        }
+        print(*app);
+        return 0;
+    }
+
+    std::printf("generation %llu, %zu applications, locale %.*s\n",
+                static_cast<unsigned long long>(registry->generation()),
+                registry->size(),
+                static_cast<int>(registry->locale().size()),
+                registry->locale().data());
+    for (std::size_t i = 0; i < registry->size(); ++i) {
+        print(registry->at(i));
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "applicationproperties.h"
+#include "constant.h"
+#include <QStringBuilder>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+QVariant mainEntryValue(const DesktopEntry &entry, const QString &valueKey, EntryValueType type) noexcept
+{
+    auto value = entry.value(fromStaticRaw(DesktopFileEntryKey), valueKey);
+    if (!value) {
+        return {};
+    }
+
+    return toTypedValue(value->get(), type, getUserLocale());
+}
+
+QStringMap localeStringValue(const DesktopEntry &entry, const QString &group, const QString &valueKey) noexcept
+{
+    auto value = entry.value(group, valueKey);
+    if (!value) {
+        return {};
+    }
+
+    return value->get().value<QStringMap>();
+}
+}  // namespace
+
+std::shared_ptr<const ApplicationProperties> ApplicationProperties::fromEntry(const DesktopEntry &entry,
+                                                                              quint64 version) noexcept
+{
+    auto ret = std::make_shared<ApplicationProperties>();
+    ret->version = version;
+
+    const auto mainGroup = fromStaticRaw(DesktopFileEntryKey);
+    ret->actions =
+        toString(mainEntryValue(entry, fromStaticRaw(DesktopEntryActions), EntryValueType::String)).split(u';', Qt::SkipEmptyParts);
+    ret->categories = mainEntryValue(entry, u"Categories"_s, EntryValueType::String).toString().split(u';', Qt::SkipEmptyParts);
+    ret->name = localeStringValue(entry, mainGroup, fromStaticRaw(DesktopEntryName));
+    ret->genericName = localeStringValue(entry, mainGroup, u"GenericName"_s);
+
+    if (auto mainExec = entry.value(mainGroup, u"Exec"_s); mainExec) {
+        ret->execs.insert(mainGroup, mainExec->get().value<QString>());
+    }
+
+    // actions are resolved once here, icons, execs and action names all need them.
+    for (const auto &action : std::as_const(ret->actions)) {
+        const QString actionKey = fromStaticRaw(DesktopFileActionKey) % action;
+        if (auto actionName = entry.value(actionKey, fromStaticRaw(DesktopEntryName)); actionName) {
+            ret->actionName.insert(action, actionName->get().value<QStringMap>());
+        }
+
+        if (auto icon = entry.value(actionKey, u"Icon"_s); icon) {
+            ret->icons.insert(actionKey, icon->get().value<QString>());
+        }
+
+        if (auto exec = entry.value(actionKey, u"Exec"_s); exec) {
+            ret->execs.insert(actionKey, exec->get().value<QString>());
+        }
+    }
+
+    if (auto mainIcon = entry.value(mainGroup, u"Icon"_s); mainIcon) {
+        ret->icons.insert(mainGroup, mainIcon->get().value<QString>());
+    }
+
+    ret->terminal = mainEntryValue(entry, u"Terminal"_s, EntryValueType::String).toBool();
+    ret->noDisplay = mainEntryValue(entry, u"NoDisplay"_s, EntryValueType::Boolean).toBool();
+    ret->startupWMClass = mainEntryValue(entry, u"StartupWMClass"_s, EntryValueType::String).toString();
+    ret->xFlatpak = !mainEntryValue(entry, u"X-flatpak"_s, EntryValueType::String).isNull();
+    ret->xLinglongAppId = mainEntryValue(entry, u"X-linglong"_s, EntryValueType::String).toString();
+    ret->xDeepinVendor = mainEntryValue(entry, u"X-Deepin-Vendor"_s, EntryValueType::String).toString();
+    ret->xDeepinCreateBy = mainEntryValue(entry, fromStaticRaw(DesktopEntryXDeepinCreateBy), EntryValueType::String).toString();
+    ret->xCreatedBy = mainEntryValue(entry, u"X-Created-By"_s, EntryValueType::String).toString();
+
+    return ret;
+}
+
+ApplicationProperties::Properties ApplicationProperties::diff(const ApplicationProperties &other) const noexcept
+{
+    Properties ret;
+    auto compare = [&ret](const auto &lhs, const auto &rhs, Property property) {
+        if (lhs != rhs) {
+            ret |= property;
+        }
+    };
+
+    compare(categories, other.categories, Categories);
+    compare(actions, other.actions, Actions);
+    compare(actionName, other.actionName, ActionName);
+    compare(name, other.name, Name);
+    compare(genericName, other.genericName, GenericName);
+    compare(icons, other.icons, Icons);
+    compare(execs, other.execs, Execs);
+    compare(terminal, other.terminal, Terminal);
+    compare(noDisplay, other.noDisplay, NoDisplay);
+    compare(startupWMClass, other.startupWMClass, StartupWMClass);
+    compare(xFlatpak, other.xFlatpak, XFlatpak);
+    compare(xLinglongAppId, other.xLinglongAppId, XLinglong);
+    compare(xDeepinVendor, other.xDeepinVendor, XDeepinVendor);
+    compare(xDeepinCreateBy, other.xDeepinCreateBy, XDeepinCreateBy);
+    compare(xCreatedBy, other.xCreatedBy, XCreatedBy);
+
+    return ret;
+}
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef APPLICATIONPROPERTIES_H
+#define APPLICATIONPROPERTIES_H
+
+#include "desktopentry.h"
+#include "global.h"
+#include <QFlags>
+#include <QStringList>
+#include <memory>
+
+// Typed snapshot of the application properties which are derived from a desktop entry.
+// It's computed once per entry, property getters and D-Bus marshalling read it instead of walking the entry again.
+// A snapshot is immutable, every change produces a new one with a greater version.
+struct ApplicationProperties
+{
+    enum Property : uint32_t {
+        NoProperty = 0,
+        Categories = 1 << 0,
+        Actions = 1 << 1,
+        ActionName = 1 << 2,
+        Name = 1 << 3,
+        GenericName = 1 << 4,
+        Icons = 1 << 5,
+        Execs = 1 << 6,
+        Terminal = 1 << 7,
+        NoDisplay = 1 << 8,
+        StartupWMClass = 1 << 9,
+        XFlatpak = 1 << 10,
+        XLinglong = 1 << 11,
+        XDeepinVendor = 1 << 12,
+        XDeepinCreateBy = 1 << 13,
+        XCreatedBy = 1 << 14,
+        AllProperties = (1 << 15) - 1
+    };
+    Q_DECLARE_FLAGS(Properties, Property)
+
+    [[nodiscard]] static std::shared_ptr<const ApplicationProperties> fromEntry(const DesktopEntry &entry,
+                                                                              quint64 version) noexcept;
+    // returns the properties whose values differ, versions aren't compared.
+    [[nodiscard]] Properties diff(const ApplicationProperties &other) const noexcept;
+
+    quint64 version{0};
+    QStringList categories;
+    QStringList actions;
+    PropMap actionName;
+    QStringMap name;
+    QStringMap genericName;
+    QStringMap icons;
+    QStringMap execs;
+    QString startupWMClass;
+    QString xLinglongAppId;
+    QString xDeepinVendor;
+    QString xDeepinCreateBy;
+    QString xCreatedBy;
+    bool terminal{false};
+    bool noDisplay{false};
+    bool xFlatpak{false};
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(ApplicationProperties::Properties)
+
+#endif
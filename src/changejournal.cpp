@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "changejournal.h"
+#include <QDateTime>
+#include <algorithm>
+
+ChangeJournal::ChangeJournal(qsizetype capacity) noexcept
+    : m_capacity(std::max<qsizetype>(capacity, 1))
+    , m_sequence(static_cast<quint64>(QDateTime::currentMSecsSinceEpoch()) * 1000)
+    , m_floor(m_sequence)
+{
+}
+
+quint64 ChangeJournal::record(ObjectChange::Kind kind, const QDBusObjectPath &object, const QStringList &properties) noexcept
+{
+    ++m_sequence;
+
+    // resetting an entry changes many properties at once, fold them into one change.
+    if (kind == ObjectChange::PropertiesChanged && !m_changes.empty()) {
+        if (auto &last = m_changes.back(); last.kind == kind && last.object == object) {
+            last.sequence = m_sequence;
+            for (const auto &property : properties) {
+                if (!last.properties.contains(property)) {
+                    last.properties.append(property);
+                }
+            }
+            return m_sequence;
+        }
+    }
+
+    m_changes.push_back(ObjectChange{m_sequence, kind, object, properties});
+    while (static_cast<qsizetype>(m_changes.size()) > m_capacity) {
+        m_floor = m_changes.front().sequence;
+        m_changes.pop_front();
+    }
+
+    return m_sequence;
+}
+
+std::optional<ObjectChangeList> ChangeJournal::changesSince(quint64 since) const noexcept
+{
+    if (since < m_floor || since > m_sequence) {
+        return std::nullopt;
+    }
+
+    auto it = std::upper_bound(m_changes.cbegin(), m_changes.cend(), since, [](quint64 seq, const ObjectChange &change) {
+        return seq < change.sequence;
+    });
+
+    return ObjectChangeList{it, m_changes.cend()};
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef CHANGEJOURNAL_H
+#define CHANGEJOURNAL_H
+
+#include <QDBusArgument>
+#include <QDBusObjectPath>
+#include <QList>
+#include <QMetaType>
+#include <QStringList>
+#include <deque>
+#include <optional>
+
+// One entry of the change journal: (sequence, kind, object, properties) -> (tuoas)
+struct ObjectChange
+{
+    enum Kind : uint { ObjectAdded = 1, ObjectRemoved = 2, PropertiesChanged = 3 };
+
+    quint64 sequence{0};
+    uint kind{0};
+    QDBusObjectPath object;
+    // names of the changed properties, only used by PropertiesChanged.
+    QStringList properties;
+};
+Q_DECLARE_METATYPE(ObjectChange)
+
+using ObjectChangeList = QList<ObjectChange>;
+Q_DECLARE_METATYPE(ObjectChangeList)
+
+inline QDBusArgument &operator<<(QDBusArgument &arg, const ObjectChange &change)
+{
+    arg.beginStructure();
+    arg << change.sequence << change.kind << change.object << change.properties;
+    arg.endStructure();
+    return arg;
+}
+
+inline const QDBusArgument &operator>>(const QDBusArgument &arg, ObjectChange &change)
+{
+    arg.beginStructure();
+    arg >> change.sequence >> change.kind >> change.object >> change.properties;
+    arg.endStructure();
+    return arg;
+}
+
+// Bounded in-memory log of objects added, removed or changed, so that a reconnecting client can catch up
+// with what it missed instead of fetching every object again.
+// Sequence numbers start at the time the journal was created in microseconds, numbers handed out by
+// a previous process are always older than the journal and require a full resync.
+class ChangeJournal
+{
+public:
+    constexpr static qsizetype DefaultCapacity = 4096;
+
+    explicit ChangeJournal(qsizetype capacity = DefaultCapacity) noexcept;
+
+    quint64 record(ObjectChange::Kind kind, const QDBusObjectPath &object, const QStringList &properties = {}) noexcept;
+    [[nodiscard]] quint64 sequence() const noexcept { return m_sequence; }
+    // changes recorded after since, std::nullopt if some of them were dropped already.
+    [[nodiscard]] std::optional<ObjectChangeList> changesSince(quint64 since) const noexcept;
+    [[nodiscard]] qsizetype size() const noexcept { return static_cast<qsizetype>(m_changes.size()); }
+
+private:
+    qsizetype m_capacity;
+    quint64 m_sequence;
+    // the oldest sequence number changesSince can still answer.
+    quint64 m_floor;
+    std::deque<ObjectChange> m_changes;
+};
+
+#endif
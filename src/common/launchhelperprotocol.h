@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+// Protocol between application manager and app-launch-helper running as a server.
+//
+// Application manager starts "app-launch-helper --server" once with one end of a SOCK_SEQPACKET socket pair
+// as its standard input, every packet is one message and every field of a message is followed by a NUL.
+//
+//   request: id | command line of app-launch-helper, one argument per field
+//   reply:   id | result of the job of the unit, "done" on success
+//
+// id is a decimal number chosen by application manager, replies may arrive in any order.
+// The helper exits when application manager closes its end of the socket.
+namespace LaunchHelperProtocol {
+
+constexpr auto ServerOption = "--server";
+// a request larger than this is rejected, the same as a command line which is too long.
+constexpr std::size_t MaxRequestSize = 128 * 1024;
+
+}  // namespace LaunchHelperProtocol
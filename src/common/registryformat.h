@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include <cstdint>
+
+// Layout of the read-only application registry which application manager publishes
+// in $XDG_RUNTIME_DIR, shared by the daemon and the client library in examples/registryReader.
+//
+// A snapshot is never modified once it's written, a new one replaces the file by rename(2),
+// so a mapping of the old file stays valid until the reader unmaps it.
+// All integers are in host byte order, the file is only meant for clients on the same machine.
+//
+//   Header | Record[recordCount] sorted by ID | string table
+//
+// Strings are UTF-8, referenced by offset and size relative to the string table and followed by a NUL.
+namespace RegistryFormat {
+
+constexpr auto FileName = "deepin-application-manager-registry";
+constexpr char Magic[4] = {'D', 'A', 'M', 'R'};
+constexpr uint32_t Version = 1;
+
+struct StringRef
+{
+    uint32_t offset;
+    uint32_t size;
+};
+
+enum RecordFlag : uint32_t { NoDisplay = 1U << 0, Terminal = 1U << 1 };
+
+struct Header
+{
+    char magic[4];
+    uint32_t version;
+    // the change sequence number of application manager when the snapshot was taken, see GetChangesSince.
+    uint64_t generation;
+    uint32_t recordCount;
+    uint32_t recordSize;
+    uint64_t recordsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    // the locale which Name and GenericName are resolved for, e.g. zh_CN.
+    StringRef locale;
+};
+
+struct Record
+{
+    StringRef id;
+    StringRef objectPath;
+    StringRef name;
+    StringRef genericName;
+    StringRef icon;
+    // separated by ';', the same as the desktop file.
+    StringRef categories;
+    StringRef exec;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(StringRef) == 8);
+static_assert(sizeof(Header) == 56);
+static_assert(sizeof(Record) == 64);
+
+}  // namespace RegistryFormat
@@ -59,6 +59,8 @@ constexpr static auto &LaunchedTimes = u"LaunchedTimes";
 constexpr static auto &InstalledTime = u"InstalledTime";
 
 constexpr static auto &ApplicationManagerHookDir = u"/deepin/dde-application-manager/hooks.d";
+constexpr static auto &ApplicationManagerCacheDir = u"/deepin/dde-application-manager";
+constexpr static auto &DesktopEntryCacheFile = u"desktop-entries.cache";
 
 constexpr static auto &ApplicationManagerToolsConfig = u"org.deepin.dde.am";
 
@@ -66,6 +68,12 @@ constexpr static auto &ApplicationManagerConfig = u"org.deepin.dde.application-m
 constexpr static auto &AppExtraEnvironments = u"appExtraEnvironments";
 constexpr static auto &AppEnvironmentsBlacklist = u"appEnvironmentsBlacklist";
 constexpr static auto &SkipEventAppIds = u"skipEventAppIds";
+constexpr static auto &VirtualObjectTree = u"virtualObjectTree";
+constexpr static auto &BatchedApplicationSignals = u"batchedApplicationSignals";
+constexpr static auto &RegistrySnapshotKey = u"registrySnapshot";
+constexpr static auto &LaunchBackendKey = u"launchBackend";
+constexpr static auto &InProcessLaunchBackend = u"inProcess";
+constexpr static auto &HelperServerLaunchBackend = u"helperServer";
 
 constexpr static auto &CompatibilityConfigFilePath = u"/var/lib/compatible/compatibleDesktop.json";
 
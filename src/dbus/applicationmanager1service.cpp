@@ -5,14 +5,21 @@
 #include "applicationHooks.h"
 #include "applicationchecker.h"
 #include "applicationservice.h"
+#include "config.h"
+#include "dconfigcache.h"
 #include "dbus/instanceservice.h"
 #include "dbus/AMobjectmanager1adaptor.h"
 #include "dbus/applicationmanager1adaptor.h"
+#include "dbus/debugadaptor.h"
 #include "desktopfilegenerator.h"
+#include "desktopidindex.h"
 #include "eventreporter.h"
 #include "global.h"
+#include "launchhelperclient.h"
+#include "launchtracer.h"
 #include "propertiesForwarder.h"
 #include "systemdsignaldispatcher.h"
+#include "transientunitlauncher.h"
 #include <DUtil>
 #include <QDBusMessage>
 #include <QDBusVariant>
@@ -21,9 +28,11 @@
 #include <QGuiApplication>
 #include <QHash>
 #include <QLoggingCategory>
+#include <QMetaProperty>
 #include <QProcess>
 #include <QSet>
 #include <QStringBuilder>
+#include <QtConcurrent>
 #include <unistd.h>
 
 using namespace Qt::StringLiterals;
@@ -31,6 +40,8 @@ using namespace Qt::StringLiterals;
 Q_LOGGING_CATEGORY(DDEAM, "dde.am.manager")
 
 namespace {
+constexpr std::size_t ApplicationLoadBatchSize = 64;
+
 template <typename Adaptor>
 void setAdaptorAutoRelaySignals(Adaptor *adaptor, bool enabled) noexcept
 {
@@ -52,6 +63,23 @@ void sendObjectManagerSignal(const QString &path, const char *member, const QDBu
     ApplicationManager1DBus::instance().globalServerBus().send(msg);
 }
 
+QVariant configValue(const QString &key) noexcept
+{
+    return DConfigCache::instance().value({}, key);
+}
+
+bool configEnabled(const QString &key) noexcept
+{
+    return configValue(key).toBool();
+}
+
+QStringList sortedIds(const QSet<QString> &ids) noexcept
+{
+    QStringList ret{ids.cbegin(), ids.cend()};
+    ret.sort();
+    return ret;
+}
+
 struct ParsedAutostartEntry
 {
     DesktopFile desktopFile;
@@ -69,14 +97,84 @@ QString desktopIdFromRelativePath(QStringView relativePath) noexcept
     return id;
 }
 
+// Returns the directory of dirs which is or contains path, or an empty string.
+QString containingDirectory(const QStringList &dirs, QStringView path) noexcept
+{
+    for (const auto &dir : dirs) {
+        if (path.startsWith(dir) && (path.size() == dir.size() || path.at(dir.size()) == u'/')) {
+            return dir;
+        }
+    }
+
+    return {};
+}
+
+// Collects the files below dir whose desktop id is id. A '-' is only tried as a directory separator
+// when such a subdirectory exists, so it costs a few stat calls instead of walking the directory.
+void collectDesktopFilesById(const QString &dir, QStringView id, QStringList &files) noexcept
+{
+    const QFileInfo info{dir % u'/' % id % desktopSuffix};
+    if (info.isFile() && info.isReadable()) {
+        files.append(info.absoluteFilePath());
+    }
+
+    for (auto hyphen = id.indexOf(u'-'); hyphen != -1; hyphen = id.indexOf(u'-', hyphen + 1)) {
+        const QFileInfo subDir{dir % u'/' % id.first(hyphen)};
+        if (subDir.isDir() && !subDir.isSymLink()) {
+            collectDesktopFilesById(subDir.absoluteFilePath(), id.sliced(hyphen + 1), files);
+        }
+    }
+}
+
+// Resolves the file which provides appId, the first applications directory providing it shadows the others.
+std::optional<DesktopFile> resolveDesktopFile(const QString &appId, const QString &currentSource) noexcept
+{
+    for (const auto &dir : getApplicationsDirs()) {
+        QStringList files;
+        collectDesktopFilesById(dir, appId, files);
+        if (files.isEmpty()) {
+            continue;
+        }
+
+        // keep the current file if it's still there, otherwise choose one deterministically.
+        std::sort(files.begin(), files.end());
+        if (auto current = files.indexOf(currentSource); current > 0) {
+            files.move(current, 0);
+        }
+
+        for (const auto &path : std::as_const(files)) {
+            if (auto file = DesktopFile::createDesktopFile(QFileInfo{path}, appId); file) {
+                return file;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+// list properties match if they contain the expected value, other properties must be equal to it.
+bool propertyMatches(const QVariant &value, const QVariant &expected) noexcept
+{
+    if (value.metaType() == QMetaType::fromType<QStringList>()) {
+        return value.toStringList().contains(expected.toString());
+    }
+
+    if (expected.metaType() == value.metaType()) {
+        return expected == value;
+    }
+
+    auto converted = expected;
+    return converted.convert(value.metaType()) && converted == value;
+}
+
 template <typename T>
-void forEachApplicationDesktopFile(T &&func) noexcept
+void forEachApplicationDesktopFile(const QStringList &dirs, T &&func) noexcept
 {
     static_assert(std::is_invocable_v<T, DesktopFile>,
                   "application desktop iterator callback should accept one DesktopFile argument");
 
     QSet<QString> seenDesktopIds;
-    for (const auto &dirPath : getApplicationsDirs()) {
+    for (const auto &dirPath : dirs) {
         const QFileInfo dirInfo{dirPath};
         if (!dirInfo.isDir()) {
             continue;
@@ -105,6 +203,12 @@ void forEachApplicationDesktopFile(T &&func) noexcept
     }
 }
 
+template <typename T>
+void forEachApplicationDesktopFile(T &&func) noexcept
+{
+    forEachApplicationDesktopFile(getApplicationsDirs(), std::forward<T>(func));
+}
+
 template <typename T>
 void forEachAutostartDesktopFile(T &&func) noexcept
 {
@@ -165,9 +269,11 @@ void forEachAutostartDesktopFile(T &&func) noexcept
 ApplicationManager1Service::~ApplicationManager1Service() = default;
 
 ApplicationManager1Service::ApplicationManager1Service(std::unique_ptr<Identifier> ptr,
-                                                       std::weak_ptr<ApplicationManager1Storage> storage) noexcept
+                                                       std::weak_ptr<ApplicationManager1Storage> storage,
+                                                       QString entryCacheFile) noexcept
     : m_identifier(std::move(ptr))
     , m_storage(std::move(storage))
+    , m_entryCache(std::move(entryCacheFile))
 {
     // Initialize prelaunch splash helper only when running on Wayland.
     bool isWayland = false;
@@ -191,6 +297,10 @@ ApplicationManager1Service::ApplicationManager1Service(std::unique_ptr<Identifie
     m_reloadTimer.setInterval(500);
     m_reloadTimer.setSingleShot(true);
     connect(&m_reloadTimer, &QTimer::timeout, this, &ApplicationManager1Service::doReloadApplications);
+
+    m_registryTimer.setInterval(100);
+    m_registryTimer.setSingleShot(true);
+    connect(&m_registryTimer, &QTimer::timeout, this, &ApplicationManager1Service::publishRegistrySnapshot);
 }
 
 void ApplicationManager1Service::initService(QDBusConnection &connection) noexcept
@@ -209,6 +319,13 @@ void ApplicationManager1Service::initService(QDBusConnection &connection) noexce
         setAdaptorAutoRelaySignals(tmp, false);
     }
 
+    if (auto *tmp = new (std::nothrow) DebugAdaptor{this}; tmp == nullptr) {
+        qCCritical(DDEAM) << "new Debug Adaptor of Application Manager failed.";
+        std::terminate();
+    } else {
+        setAdaptorAutoRelaySignals(tmp, false);
+    }
+
     if (!registerObjectToDBus(
             this, fromStaticRaw(DDEApplicationManager1ObjectPath), fromStaticRaw(ApplicationManager1Interface))) {
         std::terminate();
@@ -228,7 +345,7 @@ void ApplicationManager1Service::initService(QDBusConnection &connection) noexce
         qWarning() << "new CompatibilityManager failed.";
     }
 
-    connect(&m_watcher, &QFileSystemWatcher::directoryChanged, this, &ApplicationManager1Service::ReloadApplications);
+    connect(&m_watcher, &RecursiveFileWatcher::changed, this, &ApplicationManager1Service::scheduleReload);
 
     // Ensure all directories exist before adding watches
     const auto &userApp = getUserApplicationDir();
@@ -237,10 +354,10 @@ void ApplicationManager1Service::initService(QDBusConnection &connection) noexce
         std::terminate();
     }
 
-    const auto &desktopDirs = getApplicationsDirs();
-    auto unhandled = m_watcher.addPaths(desktopDirs);
-    for (const auto &dir : std::as_const(unhandled)) {
-        qCCritical(DDEAM) << "couldn't watch directory:" << dir;
+    for (const auto &dir : getApplicationsDirs() + getAutoStartDirs()) {
+        if (QFileInfo{dir}.isDir() && !m_watcher.addRoot(dir)) {
+            qCCritical(DDEAM) << "couldn't watch directory:" << dir;
+        }
     }
 
     auto &dispatcher = SystemdSignalDispatcher::instance();
@@ -321,8 +438,38 @@ void ApplicationManager1Service::initService(QDBusConnection &connection) noexce
         storagePtr->beginBatchUpdate();
     }
 
+    m_batchedSignals = configEnabled(fromStaticRaw(BatchedApplicationSignals));
+    m_publishRegistry = configEnabled(fromStaticRaw(RegistrySnapshotKey));
+
+    const auto launchBackend = configValue(fromStaticRaw(LaunchBackendKey)).toString();
+    if (launchBackend == fromStaticRaw(InProcessLaunchBackend)) {
+        m_unitLauncher.reset(new (std::nothrow) TransientUnitLauncher);
+    } else if (launchBackend == fromStaticRaw(HelperServerLaunchBackend)) {
+        m_unitLauncher.reset(new (std::nothrow) LaunchHelperClient);
+    }
+
+    if (m_unitLauncher) {
+        qCInfo(DDEAM) << "applications are launched by the" << launchBackend << "backend.";
+    } else {
+        qCInfo(DDEAM) << "applications are launched by running app-launch-helper for each launch.";
+    }
+
+    if (configEnabled(fromStaticRaw(VirtualObjectTree))) {
+        if (m_objectTree.reset(new (std::nothrow) ApplicationObjectTree{this}); !m_objectTree) {
+            qCWarning(DDEAM) << "new ApplicationObjectTree failed, applications are registered one by one.";
+        } else {
+            qCInfo(DDEAM) << "applications are served by the virtual object tree.";
+        }
+    }
+
+    m_entryCache.load();
+
     scanApplications();
 
+    if (!m_entryCache.save()) {
+        qCWarning(DDEAM) << "failed to save desktop entry cache, all desktop files will be parsed at next startup.";
+    }
+
     updateAutostartStatus();
 
     scanInstances();
@@ -351,6 +498,10 @@ void ApplicationManager1Service::initService(QDBusConnection &connection) noexce
 
     qCInfo(DDEAM) << "Application Manager started.";
 
+    if (m_publishRegistry) {
+        publishRegistrySnapshot();
+    }
+
     for (const auto &application : std::as_const(m_applicationList)) {
         if (!application->ensurePropertiesForwarder()) {
             qCCritical(DDEAM) << "failed to initialize PropertiesForwarder for" << application->id();
@@ -441,18 +592,95 @@ void ApplicationManager1Service::reloadMimeInfos() noexcept
 {
     m_mimeManager->reset();
     scanMimeInfos();
+    // MimeTypes of every application depends on the mime caches.
+    m_managedObjects.clear();
     emit m_mimeManager->MimeInfoReloaded();
 }
 
 void ApplicationManager1Service::scanApplications() noexcept
 {
-    forEachApplicationDesktopFile([this](DesktopFile file) -> bool {
-        const auto desktopId = file.desktopId();
-        if (!addApplication(std::move(file))) {
-            qWarning() << "add Application" << desktopId << " failed, skip...";
-        }
+    std::vector<PendingApplication> pending;
+    QHash<QString, QString> desktopIds;
+    forEachApplicationDesktopFile([&pending, &desktopIds](DesktopFile file) -> bool {
+        desktopIds.insert(file.desktopId(), file.sourcePath());
+        pending.push_back(PendingApplication{std::move(file)});
         return false;
     });
+
+    DesktopIdIndex::instance().reset(std::move(desktopIds));
+    loadApplications(std::move(pending));
+}
+
+void ApplicationManager1Service::parsePendingApplication(PendingApplication &pending) noexcept
+{
+    if (!pending.entry) {
+        auto entry = std::make_unique<DesktopEntry>();
+        if (auto err = entry->parse(pending.file, ApplicationEntryDecoding); err != ParserError::NoError) {
+            qDebug() << "parse failed:" << err << pending.file.sourcePath();
+            return;
+        }
+        pending.entry = std::move(entry);
+    }
+
+    // existing applications keep their visibility on update, see updateApplication.
+    pending.shown = pending.existing || ApplicationService::shouldBeShown(pending.entry);
+}
+
+void ApplicationManager1Service::loadApplications(std::vector<PendingApplication> pending) noexcept
+{
+    // DesktopEntryCache isn't thread-safe, so hits are resolved here and only misses are parsed by workers.
+    for (auto &item : pending) {
+        item.entry = m_entryCache.find(item.file, ApplicationEntryDecoding);
+        item.fromCache = static_cast<bool>(item.entry);
+    }
+
+    std::vector<std::vector<PendingApplication>> batches;
+    batches.reserve(pending.size() / ApplicationLoadBatchSize + 1);
+    for (auto &item : pending) {
+        if (batches.empty() || batches.back().size() == ApplicationLoadBatchSize) {
+            batches.emplace_back().reserve(ApplicationLoadBatchSize);
+        }
+        batches.back().push_back(std::move(item));
+    }
+    pending.clear();
+
+    if (batches.empty()) {
+        return;
+    }
+
+    // D-Bus registration must stay on this thread, so the next batch is parsed while the current one is registered.
+    auto future = QtConcurrent::map(batches.front(), &ApplicationManager1Service::parsePendingApplication);
+    for (std::size_t i = 0; i < batches.size(); ++i) {
+        future.waitForFinished();
+        if (i + 1 < batches.size()) {
+            future = QtConcurrent::map(batches[i + 1], &ApplicationManager1Service::parsePendingApplication);
+        }
+
+        for (auto &item : batches[i]) {
+            if (!item.entry) {
+                continue;
+            }
+
+            if (!item.fromCache) {
+                m_entryCache.insert(item.file, *item.entry);
+            }
+
+            if (item.existing) {
+                updateApplication(item.existing, std::move(item.file), std::move(item.entry));
+                continue;
+            }
+
+            if (!item.shown) {
+                qDebug() << "application shouldn't be shown:" << item.file.sourcePath();
+                continue;
+            }
+
+            const auto desktopId = item.file.desktopId();
+            if (!addApplication(std::move(item.file), std::move(item.entry))) {
+                qWarning() << "add Application" << desktopId << " failed, skip...";
+            }
+        }
+    }
 }
 
 void ApplicationManager1Service::scanInstances() noexcept
@@ -610,17 +838,26 @@ QSharedPointer<ApplicationService> ApplicationManager1Service::addApplication(De
     }
 
     auto *ptr = application.data();
-    if (auto *adaptor = new (std::nothrow) ApplicationAdaptor{ptr}; adaptor == nullptr) {
-        qCritical() << "new ApplicationAdaptor failed.";
-        return nullptr;
+    if (m_objectTree) {
+        if (!registerVirtualObjectToDBus(m_objectTree.get(), application->applicationPath().path())) {
+            return nullptr;
+        }
     } else {
-        setAdaptorAutoRelaySignals(adaptor, false);
-    }
+        if (auto *adaptor = new (std::nothrow) ApplicationAdaptor{ptr}; adaptor == nullptr) {
+            qCritical() << "new ApplicationAdaptor failed.";
+            return nullptr;
+        } else {
+            setAdaptorAutoRelaySignals(adaptor, false);
+        }
 
-    if (!registerObjectToDBus(ptr, application->applicationPath().path(), fromStaticRaw(ApplicationInterface))) {
-        return nullptr;
+        if (!registerObjectToDBus(ptr, application->applicationPath().path(), fromStaticRaw(ApplicationInterface))) {
+            return nullptr;
+        }
     }
     m_applicationList.insert(application->id(), application);
+    watchManagedObject(ptr);
+    // building the config in Launch would delay the first launch of every application.
+    DConfigCache::instance().prefetch(application->id());
 
     if (!m_startupPhase && !application->ensurePropertiesForwarder()) {
         qCCritical(DDEAM) << "failed to initialize PropertiesForwarder for" << application->id();
@@ -628,8 +865,28 @@ QSharedPointer<ApplicationService> ApplicationManager1Service::addApplication(De
     }
 
     if (!m_startupPhase) {
-        const auto interfaces = getChildInterfacesAndPropertiesFromObject(ptr);
-        emit listChanged();
+        m_changeJournal.record(ObjectChange::ObjectAdded, application->applicationPath());
+        scheduleRegistrySnapshot();
+    }
+
+    if (m_reloadDelta) {
+        // removed and added again in one reload, e.g. the desktop file moved to another directory.
+        if (!m_reloadDelta->removed.remove(application->id())) {
+            m_reloadDelta->added.insert(application->id());
+        } else {
+            m_reloadDelta->updated.insert(application->id());
+        }
+
+        if (m_batchedSignals) {
+            return application;
+        }
+    }
+
+    if (!m_startupPhase) {
+        const auto interfaces = application->interfacesAndProperties();
+        if (!m_reloadDelta) {
+            emit listChanged();
+        }
         emit InterfacesAdded(application->applicationPath(), interfaces);
         sendObjectManagerSignal(fromStaticRaw(DDEApplicationManager1ObjectPath),
                                 "InterfacesAdded",
@@ -644,12 +901,25 @@ void ApplicationManager1Service::removeOneApplication(const QString &appId) noex
 {
     auto objectPath = QDBusObjectPath{getObjectPathFromAppId(appId)};
     if (auto it = m_applicationList.constFind(appId); it != m_applicationList.cend()) {
-        const auto interfaces = getChildInterfacesFromObject(it->data());
-        emit InterfacesRemoved(objectPath, interfaces);
-        sendObjectManagerSignal(fromStaticRaw(DDEApplicationManager1ObjectPath),
-                                "InterfacesRemoved",
-                                objectPath,
-                                QVariant::fromValue(interfaces));
+        DConfigCache::instance().remove(u'/' % appId);
+        m_changeJournal.record(ObjectChange::ObjectRemoved, objectPath);
+        scheduleRegistrySnapshot();
+
+        if (m_reloadDelta) {
+            m_reloadDelta->updated.remove(appId);
+            if (!m_reloadDelta->added.remove(appId)) {
+                m_reloadDelta->removed.insert(appId);
+            }
+        }
+
+        if (!m_reloadDelta || !m_batchedSignals) {
+            const auto interfaces = it.value()->interfaces();
+            emit InterfacesRemoved(objectPath, interfaces);
+            sendObjectManagerSignal(fromStaticRaw(DDEApplicationManager1ObjectPath),
+                                    "InterfacesRemoved",
+                                    objectPath,
+                                    QVariant::fromValue(interfaces));
+        }
         if (auto ptr = m_storage.lock(); ptr) {
             if (!ptr->deleteApplication(appId)) {
                 qCritical() << "failed to delete all properties of" << appId;
@@ -658,8 +928,11 @@ void ApplicationManager1Service::removeOneApplication(const QString &appId) noex
         unregisterObjectFromDBus(objectPath.path());
         std::ignore = it->data()->RemoveFromDesktop();
         m_applicationList.erase(it);
+        m_managedObjects.remove(appId);
 
-        emit listChanged();
+        if (!m_reloadDelta) {
+            emit listChanged();
+        }
     }
 }
 
@@ -720,25 +993,55 @@ void ApplicationManager1Service::updateApplication(const QSharedPointer<Applicat
         return;
     }
 
-    auto *newEntry = new (std::nothrow) DesktopEntry{};
-    if (newEntry == nullptr) {
-        qCritical() << "new DesktopEntry failed.";
-        return;
+    auto newEntry = m_entryCache.find(desktopFile, ApplicationEntryDecoding);
+    if (!newEntry) {
+        newEntry.reset(new (std::nothrow) DesktopEntry{});
+        if (!newEntry) {
+            qCritical() << "new DesktopEntry failed.";
+            return;
+        }
+
+        auto err = newEntry->parse(desktopFile, ApplicationEntryDecoding);
+        if (err != ParserError::NoError) {
+            qWarning() << "update desktop file failed:" << err << ", content wouldn't change.";
+            return;
+        }
+
+        m_entryCache.insert(desktopFile, *newEntry);
     }
 
-    auto err = newEntry->parse(desktopFile);
-    if (err != ParserError::NoError) {
-        qWarning() << "update desktop file failed:" << err << ", content wouldn't change.";
+    updateApplication(destApp, std::move(desktopFile), std::move(newEntry));
+}
+
+void ApplicationManager1Service::updateApplication(const QSharedPointer<ApplicationService> &destApp,
+                                                   DesktopFile desktopFile,
+                                                   std::unique_ptr<DesktopEntry> newEntry) noexcept
+{
+    if (!m_applicationList.contains(destApp->id())) {
         return;
     }
 
-    if (*(destApp->m_entry) != *newEntry) {
-        destApp->resetEntry(newEntry);
+    // entries parsed from files carry a content hash, comparing it avoids walking every value.
+    const auto oldHash = destApp->m_entry->contentHash();
+    const auto newHash = newEntry->contentHash();
+    const bool changed = (oldHash != 0 && newHash != 0) ? oldHash != newHash : *(destApp->m_entry) != *newEntry;
+    if (changed) {
+        destApp->resetEntry(newEntry.release());
         destApp->detachAllInstance();
+        recordUpdatedApplication(destApp->id());
+        // the config may have been unavailable when the application was added.
+        DConfigCache::instance().prefetch(destApp->id());
     }
 
-    if (destApp->m_desktopSource != desktopFile && destApp->isAutoStart()) {
+    // the stat signature of the stored source short-circuits the next reload, keep it current.
+    if (destApp->m_desktopSource != desktopFile) {
+        const bool pathChanged = destApp->m_desktopSource.sourcePath() != desktopFile.sourcePath();
         destApp->m_desktopSource = std::move(desktopFile);
+        if (pathChanged) {
+            invalidateManagedObject(destApp->id());
+            emit destApp->desktopSourcePathChanged();
+            recordUpdatedApplication(destApp->id());
+        }
     }
 
     destApp->syncGeneratedAutostartEntry();
@@ -746,6 +1049,8 @@ void ApplicationManager1Service::updateApplication(const QSharedPointer<Applicat
 
 void ApplicationManager1Service::ReloadApplications()
 {
+    // explicit requests don't tell what changed, rescan everything.
+    m_fullReloadRequested = true;
     if (m_isReloading) {
         qInfo() << "reload already in progress, deferring.";
         m_pendingReload = true;
@@ -758,48 +1063,506 @@ void ApplicationManager1Service::ReloadApplications()
     m_reloadTimer.start();
 }
 
+void ApplicationManager1Service::scheduleReload() noexcept
+{
+    if (m_isReloading) {
+        m_pendingReload = true;
+        return;
+    }
+
+    // changes usually come in bursts (e.g. package installation), handle them together.
+    m_reloadTimer.start();
+}
+
 void ApplicationManager1Service::doReloadApplications()
 {
     m_isReloading = true;
     m_pendingReload = false;
+    beginReloadTransaction();
+
+    const auto changes = m_watcher.takeChanges();
+    if (std::exchange(m_fullReloadRequested, false) || changes.overflowed) {
+        reloadAllApplications();
+    } else if (!changes.isEmpty()) {
+        reloadChangedApplications(changes);
+    }
+
+    finishReloadTransaction();
+    m_isReloading = false;
+
+    if (m_pendingReload) {
+        m_pendingReload = false;
+        qInfo() << "pending reload detected, scheduling deferred reload.";
+        m_reloadTimer.start();
+    }
+}
+
+void ApplicationManager1Service::beginReloadTransaction() noexcept
+{
+    m_reloadDelta.emplace();
+}
+
+void ApplicationManager1Service::finishReloadTransaction() noexcept
+{
+    const auto delta = std::exchange(m_reloadDelta, std::nullopt);
+    if (!delta || delta->isEmpty()) {
+        return;
+    }
+
+    if (!delta->added.isEmpty() || !delta->removed.isEmpty()) {
+        emit listChanged();
+    }
+
+    const auto added = sortedIds(delta->added);
+    const auto removed = sortedIds(delta->removed);
+    const auto updated = sortedIds(delta->updated);
+    emit ApplicationsChanged(added, removed, updated);
+
+    auto msg = QDBusMessage::createSignal(fromStaticRaw(DDEApplicationManager1ObjectPath),
+                                          fromStaticRaw(ApplicationManager1Interface),
+                                          u"ApplicationsChanged"_s);
+    msg << added << removed << updated;
+    ApplicationManager1DBus::instance().globalServerBus().send(msg);
+}
+
+void ApplicationManager1Service::recordUpdatedApplication(const QString &appId) noexcept
+{
+    // applications added by this reload are announced as added only.
+    if (m_reloadDelta && !m_reloadDelta->added.contains(appId)) {
+        m_reloadDelta->updated.insert(appId);
+    }
+}
+
+void ApplicationManager1Service::reloadAllApplications() noexcept
+{
     qInfo() << "reload applications.";
 
-    auto appIds = m_applicationList.keys();
+    reloadApplicationsFrom(getApplicationsDirs());
 
-    forEachApplicationDesktopFile([this, &appIds](DesktopFile file) -> bool {
+    if (!m_entryCache.save()) {
+        qCWarning(DDEAM) << "failed to save desktop entry cache.";
+    }
+
+    updateAutostartStatus();
+
+    reloadMimeInfos();
+}
+
+void ApplicationManager1Service::reloadApplicationsFrom(const QStringList &dirs) noexcept
+{
+    QSet<QString> staleIds{m_applicationList.keyBegin(), m_applicationList.keyEnd()};
+    qsizetype unchanged{0};
+
+    std::vector<PendingApplication> pending;
+    QHash<QString, QString> desktopIds;
+    forEachApplicationDesktopFile(dirs, [this, &staleIds, &unchanged, &pending, &desktopIds](DesktopFile file) -> bool {
+        desktopIds.insert(file.desktopId(), file.sourcePath());
         auto app = m_applicationList.value(file.desktopId());
-        if (app && appIds.contains(app->id())) {
-            appIds.removeOne(app->id());
-            updateApplication(app, std::move(file));
+        if (!app) {
+            pending.push_back(PendingApplication{std::move(file)});
             return false;
         }
 
-        addApplication(std::move(file));
+        staleIds.remove(app->id());
+
+        // the same file with the same stat signature, neither its entry nor the cache record need to be touched.
+        const auto &source = app->desktopFileSource();
+        if (source.sourcePath() == file.sourcePath() && source.modifiedTime() == file.modifiedTime() &&
+            source.createTime() == file.createTime()) {
+            if (!m_entryCache.touch(file) && app->m_entry->contentHash() != 0) {
+                // the record is gone, e.g. the cache file was removed, keep the entry which is already loaded.
+                m_entryCache.insert(file, *app->m_entry);
+            }
+            ++unchanged;
+            return false;
+        }
+
+        pending.push_back(PendingApplication{std::move(file), nullptr, std::move(app)});
         return false;
     });
 
-    for (const auto &appId : std::as_const(appIds)) {
+    DesktopIdIndex::instance().reset(std::move(desktopIds));
+    qDebug() << "skip" << unchanged << "unchanged applications, reload" << pending.size() << "applications.";
+    loadApplications(std::move(pending));
+
+    for (const auto &appId : std::as_const(staleIds)) {
         removeOneApplication(appId);
     }
+}
 
-    updateAutostartStatus();
+void ApplicationManager1Service::reloadChangedApplications(const RecursiveFileWatcher::Changes &changes) noexcept
+{
+    const auto &appDirs = getApplicationsDirs();
+    const auto &autostartDirs = getAutoStartDirs();
 
-    reloadMimeInfos();
+    QSet<QString> affectedIds;
+    bool autostartChanged{false};
+    bool mimeCacheChanged{false};
 
-    EventReporter::instance().initialize();
+    for (const auto &path : changes.files) {
+        if (!containingDirectory(autostartDirs, path).isEmpty()) {
+            autostartChanged = autostartChanged || path.endsWith(desktopSuffix);
+            continue;
+        }
 
-    m_isReloading = false;
+        const auto root = containingDirectory(appDirs, path);
+        if (root.isEmpty()) {
+            continue;
+        }
 
-    if (m_pendingReload) {
-        m_pendingReload = false;
-        qInfo() << "pending reload detected, scheduling deferred reload.";
-        m_reloadTimer.start();
+        if (QStringView{path}.sliced(path.lastIndexOf(u'/') + 1) == QStringView{MimeinfoCache}) {
+            mimeCacheChanged = true;
+        } else if (path.endsWith(desktopSuffix)) {
+            affectedIds.insert(desktopIdFromRelativePath(QStringView{path}.sliced(root.size() + 1)));
+        }
+    }
+
+    for (const auto &path : changes.directories) {
+        if (!containingDirectory(autostartDirs, path).isEmpty()) {
+            autostartChanged = true;
+            continue;
+        }
+
+        const auto root = containingDirectory(appDirs, path);
+        if (root.isEmpty()) {
+            continue;
+        }
+
+        // the directory may be gone, applications provided by files below it are affected,
+        // so are the files which appeared below it.
+        const QString prefix = path % u'/';
+        for (const auto &app : std::as_const(m_applicationList)) {
+            if (app->desktopFileSource().sourcePath().startsWith(prefix)) {
+                affectedIds.insert(app->id());
+            }
+        }
+
+        QDirIterator it{path, {u"*.desktop"_s}, QDir::Files | QDir::NoDotAndDotDot | QDir::Readable, QDirIterator::Subdirectories};
+        while (it.hasNext()) {
+            const auto filePath = it.nextFileInfo().absoluteFilePath();
+            affectedIds.insert(desktopIdFromRelativePath(QStringView{filePath}.sliced(root.size() + 1)));
+        }
+    }
+
+    affectedIds.remove(QString{});
+    qInfo() << "reload" << affectedIds.size() << "changed applications.";
+
+    auto &index = DesktopIdIndex::instance();
+    std::vector<PendingApplication> pending;
+    pending.reserve(affectedIds.size());
+    for (const auto &appId : std::as_const(affectedIds)) {
+        auto app = m_applicationList.value(appId);
+        const auto currentSource = app ? app->desktopFileSource().sourcePath() : index.path(appId);
+        auto file = resolveDesktopFile(appId, currentSource);
+        if (file) {
+            index.insert(appId, file->sourcePath());
+        } else {
+            index.remove(appId);
+        }
+
+        if (app && containingDirectory(appDirs, currentSource).isEmpty()) {
+            // provided by an autostart file, see updateAutostartStatus.
+            continue;
+        }
+
+        if (!file) {
+            if (app) {
+                removeOneApplication(appId);
+            }
+            continue;
+        }
+
+        pending.push_back(PendingApplication{std::move(file).value(), nullptr, std::move(app)});
+    }
+
+    loadApplications(std::move(pending));
+
+    if (!m_entryCache.save(DesktopEntryCache::Retention::All)) {
+        qCWarning(DDEAM) << "failed to save desktop entry cache.";
+    }
+
+    if (autostartChanged || !affectedIds.isEmpty()) {
+        updateAutostartStatus();
+    }
+
+    if (mimeCacheChanged) {
+        reloadMimeInfos();
     }
 }
 
 ObjectMap ApplicationManager1Service::GetManagedObjects() const
 {
-    return dumpDBusObject(m_applicationList);
+    const auto applicationInterface = fromStaticRaw(ApplicationInterface);
+    const auto onDesktopProperty = u"isOnDesktop"_s;
+
+    ObjectMap objs;
+    for (auto it = m_applicationList.cbegin(); it != m_applicationList.cend(); ++it) {
+        auto cached = m_managedObjects.find(it.key());
+        if (cached == m_managedObjects.end()) {
+            ++m_managedObjectsStats.misses;
+            auto interfaces = it.value()->interfacesAndProperties();
+            if (interfaces.isEmpty()) {
+                continue;
+            }
+            cached = m_managedObjects.insert(it.key(), std::move(interfaces));
+        } else {
+            ++m_managedObjectsStats.hits;
+            // isOnDesktop follows a symlink on the desktop which may change behind our back, it's always read again.
+            if (auto iface = cached->constFind(applicationInterface); iface != cached->cend()) {
+                const auto onDesktop = it.value()->isOnDesktop();
+                if (iface->value(onDesktopProperty).toBool() != onDesktop) {
+                    (*cached)[applicationInterface].insert(onDesktopProperty, onDesktop);
+                }
+            }
+        }
+
+        objs.insert(QDBusObjectPath{getObjectPathFromAppId(it.key())}, *cached);
+    }
+
+    return objs;
+}
+
+void ApplicationManager1Service::watchManagedObject(const ApplicationService *app) noexcept
+{
+    const auto *mo = app->metaObject();
+    const auto slot = metaObject()->method(metaObject()->indexOfSlot("onApplicationPropertyChanged()"));
+    for (auto i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
+        if (const auto prop = mo->property(i); prop.hasNotifySignal()) {
+            connect(app, prop.notifySignal(), this, slot);
+        }
+    }
+
+    // MimeTypes has no NOTIFY signal, but setMimeTypes announces changes anyway.
+    connect(app, &ApplicationService::MimeTypesChanged, this, &ApplicationManager1Service::onApplicationPropertyChanged);
+}
+
+void ApplicationManager1Service::onApplicationPropertyChanged()
+{
+    const auto *app = qobject_cast<const ApplicationService *>(sender());
+    if (app == nullptr) {
+        return;
+    }
+
+    m_managedObjects.remove(app->id());
+    if (m_startupPhase || app->m_resettingEntry) {
+        return;
+    }
+
+    const auto signalIndex = senderSignalIndex();
+    const auto *mo = app->metaObject();
+    QStringList properties;
+    if (signalIndex == mo->indexOfSignal("MimeTypesChanged()")) {
+        properties.append(u"MimeTypes"_s);
+    } else {
+        for (auto i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
+            if (const auto prop = mo->property(i); prop.notifySignalIndex() == signalIndex) {
+                properties.append(QString::fromLatin1(prop.name()));
+            }
+        }
+    }
+
+    recordPropertiesChanged(app, properties);
+}
+
+void ApplicationManager1Service::recordPropertiesChanged(const ApplicationService *app, const QStringList &properties) noexcept
+{
+    if (m_startupPhase || properties.isEmpty()) {
+        return;
+    }
+
+    m_changeJournal.record(ObjectChange::PropertiesChanged, app->applicationPath(), properties);
+
+    // only the properties which are part of the registry snapshot need a new one.
+    static const QStringList snapshotProperties{
+        u"Name"_s, u"GenericName"_s, u"Icons"_s, u"Categories"_s, u"Execs"_s, u"NoDisplay"_s, u"Terminal"_s};
+    if (std::any_of(properties.cbegin(), properties.cend(), [](const QString &property) {
+            return snapshotProperties.contains(property);
+        })) {
+        scheduleRegistrySnapshot();
+    }
+}
+
+void ApplicationManager1Service::scheduleRegistrySnapshot() noexcept
+{
+    if (m_publishRegistry && !m_startupPhase) {
+        m_registryTimer.start();
+    }
+}
+
+void ApplicationManager1Service::publishRegistrySnapshot() noexcept
+{
+    const auto locale = getUserLocale();
+    const auto mainGroup = fromStaticRaw(DesktopFileEntryKey);
+
+    QList<RegistrySnapshot::Application> applications;
+    applications.reserve(m_applicationList.size());
+    for (const auto &app : std::as_const(m_applicationList)) {
+        const auto properties = app->properties();
+        if (!properties) {
+            continue;
+        }
+
+        const auto localized = app->localizedProperties(locale);
+        applications.append(RegistrySnapshot::Application{
+            app->id(),
+            app->applicationPath().path(),
+            localized.value(u"Name"_s).toString(),
+            localized.value(u"GenericName"_s).toString(),
+            properties->icons.value(mainGroup),
+            properties->categories,
+            properties->execs.value(mainGroup),
+            app->noDisplay(),
+            app->terminal(),
+        });
+    }
+
+    const auto generation = m_changeJournal.sequence();
+    const auto snapshot = RegistrySnapshot::serialize(applications, generation, locale.name());
+    if (!RegistrySnapshot::write(m_registryPath, snapshot)) {
+        return;
+    }
+
+    qCDebug(DDEAM) << "published registry snapshot of" << applications.size() << "applications, generation" << generation;
+    emit RegistrySnapshotChanged(m_registryPath, generation);
+
+    auto msg = QDBusMessage::createSignal(fromStaticRaw(DDEApplicationManager1ObjectPath),
+                                          fromStaticRaw(ApplicationManager1Interface),
+                                          u"RegistrySnapshotChanged"_s);
+    msg << m_registryPath << static_cast<qulonglong>(generation);
+    ApplicationManager1DBus::instance().globalServerBus().send(msg);
+}
+
+ObjectInterfaceMap ApplicationManager1Service::GetLocalizedProperties(const QStringList &app_ids,
+                                                                      const QString &locale) const noexcept
+{
+    const auto resolved = locale.isEmpty() ? getUserLocale() : QLocale{locale};
+    const auto ids = app_ids.isEmpty() ? m_applicationList.keys() : app_ids;
+
+    ObjectInterfaceMap ret;
+    for (const auto &id : ids) {
+        if (const auto app = m_applicationList.value(id); app) {
+            ret.insert(id, app->localizedProperties(resolved));
+        }
+    }
+
+    return ret;
+}
+
+qulonglong ApplicationManager1Service::GetChangesSince(qulonglong since,
+                                                       bool &resync_required,
+                                                       ObjectChangeList &changes) const noexcept
+{
+    auto ret = m_changeJournal.changesSince(since);
+    resync_required = !ret.has_value();
+    changes = std::move(ret).value_or(ObjectChangeList{});
+    return m_changeJournal.sequence();
+}
+
+ObjectInterfaceMap ApplicationManager1Service::GetLaunchLatency(const QString &app_id) const noexcept
+{
+    ObjectInterfaceMap ret;
+    const auto statistics = LaunchTracer::instance().statistics(app_id);
+    for (auto it = statistics.cbegin(); it != statistics.cend(); ++it) {
+        const auto &percentiles = it.value();
+        ret.insert(it.key(),
+                   QVariantMap{{u"count"_s, QVariant::fromValue<qulonglong>(percentiles.count)},
+                               {u"p50"_s, QVariant::fromValue<qlonglong>(percentiles.p50)},
+                               {u"p90"_s, QVariant::fromValue<qlonglong>(percentiles.p90)},
+                               {u"p99"_s, QVariant::fromValue<qlonglong>(percentiles.p99)},
+                               {u"max"_s, QVariant::fromValue<qlonglong>(percentiles.max)}});
+    }
+
+    return ret;
+}
+
+void ApplicationManager1Service::ResetLaunchLatency() noexcept
+{
+    LaunchTracer::instance().reset();
+}
+
+QVariantMap ApplicationManager1Service::GetManagedObjectsCacheStats() const noexcept
+{
+    return {{u"hits"_s, QVariant::fromValue<qulonglong>(m_managedObjectsStats.hits)},
+            {u"misses"_s, QVariant::fromValue<qulonglong>(m_managedObjectsStats.misses)}};
+}
+
+QVariantMap ApplicationManager1Service::GetPropertiesChangedStats() const noexcept
+{
+    const auto stats = PropertiesForwarder::stats();
+    return {{u"notifications"_s, QVariant::fromValue<qulonglong>(stats.notifications)},
+            {u"messages"_s, QVariant::fromValue<qulonglong>(stats.messages)},
+            {u"saved"_s, QVariant::fromValue<qulonglong>(stats.saved())}};
+}
+
+void ApplicationManager1Service::invalidateManagedObject(const QString &appId) noexcept
+{
+    m_managedObjects.remove(appId);
+}
+
+ObjectInterfaceMap ApplicationManager1Service::ListApplications(const QStringList &properties,
+                                                                const QVariantMap &filter,
+                                                                uint offset,
+                                                                uint limit,
+                                                                uint &total) const noexcept
+{
+    total = 0;
+    const auto &mo = ApplicationService::staticMetaObject;
+    auto propertyOf = [&mo](const QString &name) -> std::optional<QMetaProperty> {
+        const auto index = mo.indexOfProperty(name.toLatin1().constData());
+        if (index < mo.propertyOffset()) {
+            return std::nullopt;
+        }
+        return mo.property(index);
+    };
+
+    QList<std::pair<QString, QMetaProperty>> requested;
+    requested.reserve(properties.size());
+    for (const auto &name : properties) {
+        auto prop = propertyOf(name);
+        if (!prop) {
+            safe_sendErrorReply(QDBusError::InvalidArgs, u"unknown property: %1"_s.arg(name));
+            return {};
+        }
+        requested.append({name, *prop});
+    }
+
+    QList<std::pair<QMetaProperty, QVariant>> conditions;
+    conditions.reserve(filter.size());
+    for (auto it = filter.cbegin(); it != filter.cend(); ++it) {
+        auto prop = propertyOf(it.key());
+        if (!prop) {
+            safe_sendErrorReply(QDBusError::InvalidArgs, u"unknown filter property: %1"_s.arg(it.key()));
+            return {};
+        }
+        conditions.append({*prop, it.value()});
+    }
+
+    auto appIds = m_applicationList.keys();
+    std::sort(appIds.begin(), appIds.end());
+
+    ObjectInterfaceMap ret;
+    for (const auto &appId : std::as_const(appIds)) {
+        const auto *app = m_applicationList.value(appId).data();
+        const bool matched = std::all_of(conditions.cbegin(), conditions.cend(), [app](const auto &condition) {
+            return propertyMatches(condition.first.read(app), condition.second);
+        });
+        if (!matched) {
+            continue;
+        }
+
+        const auto index = total++;
+        if (index < offset || (limit != 0 && index - offset >= limit)) {
+            continue;
+        }
+
+        QVariantMap values;
+        for (const auto &[name, prop] : std::as_const(requested)) {
+            values.insert(name, prop.read(app));
+        }
+        ret.insert(ret.cend(), appId, std::move(values));
+    }
+
+    return ret;
 }
 
 QHash<QDBusObjectPath, QSharedPointer<ApplicationService>>
@@ -895,12 +1658,16 @@ QString ApplicationManager1Service::addUserApplication(const QVariantMap &deskto
 
     auto desktopSource = std::move(ret).value();
     auto appId = desktopSource.desktopId();
+    auto sourcePath = desktopSource.sourcePath();
     if (!addApplication(std::move(desktopSource))) {
         file.remove();
         safe_sendErrorReply(QDBusError::Failed, "add application to ApplicationManager failed.");
         return {};
     }
 
+    // the user directory takes precedence over every other applications directory.
+    DesktopIdIndex::instance().insert(appId, sourcePath);
+
     m_mimeManager->updateMimeCache(appDir.absolutePath());
     return appId;
 }
@@ -10,20 +10,31 @@
 #include <QDBusUnixFileDescriptor>
 #include <QSharedPointer>
 #include <memory>
+#include <optional>
+#include <vector>
 #include <QMap>
 #include <QHash>
-#include <QFileSystemWatcher>
+#include <QSet>
 #include <QTimer>
 #include "applicationmanagerstorage.h"
+#include "changejournal.h"
+#include "dbus/applicationobjecttree.h"
 #include "dbus/jobmanager1service.h"
 #include "dbus/mimemanager1service.h"
 #include "desktopentry.h"
+#include "desktopentrycache.h"
 #include "identifier.h"
 #include "compatibilitymanager.h"
 #include "prelaunchsplashhelper.h"
+#include "recursivefilewatcher.h"
+#include "registrysnapshot.h"
+#include "unitlauncher.h"
 
 Q_DECLARE_LOGGING_CATEGORY(DDEAM)
 
+// Most translations of an application are never requested, so values are decoded when they're read.
+constexpr static auto ApplicationEntryDecoding = ValueDecoding::LazyMemoized;
+
 class ApplicationService;
 
 class UnitResultWatcher : public QObject
@@ -62,8 +73,10 @@ class ApplicationManager1Service final : public QObject, protected QDBusContext
     friend class ApplicationService;
 
 public:
+    // entryCacheFile is where parsed desktop entries are kept between runs, see DesktopEntryCache.
     explicit ApplicationManager1Service(std::unique_ptr<Identifier> ptr,
-                                        std::weak_ptr<ApplicationManager1Storage> storage) noexcept;
+                                        std::weak_ptr<ApplicationManager1Storage> storage,
+                                        QString entryCacheFile = DesktopEntryCache::defaultCacheFile()) noexcept;
     ~ApplicationManager1Service() override;
     ApplicationManager1Service(const ApplicationManager1Service &) = delete;
     ApplicationManager1Service(ApplicationManager1Service &&) = delete;
@@ -93,6 +106,21 @@ public:
     [[nodiscard]] PrelaunchSplashHelper *splashHelper() const noexcept { return m_splashHelper.get(); }
     [[nodiscard]] bool isNewSession() const noexcept { return m_isNewSession; }
     [[nodiscard]] bool isStartupPhase() const noexcept { return m_startupPhase; }
+    [[nodiscard]] DesktopEntryCache &entryCache() noexcept { return m_entryCache; }
+    [[nodiscard]] ChangeJournal &changeJournal() noexcept { return m_changeJournal; }
+    // non-null if applications are served by the virtual object tree instead of their own adaptors.
+    [[nodiscard]] ApplicationObjectTree *objectTree() const noexcept { return m_objectTree.get(); }
+    // non-null if launches don't run app-launch-helper for each of them.
+    [[nodiscard]] UnitLauncher *unitLauncher() const noexcept { return m_unitLauncher.get(); }
+
+    struct ManagedObjectsCacheStats
+    {
+        quint64 hits{0};
+        quint64 misses{0};
+    };
+    [[nodiscard]] ManagedObjectsCacheStats managedObjectsCacheStats() const noexcept { return m_managedObjectsStats; }
+    // drops the cached GetManagedObjects part of appId, for changes which aren't announced by a NOTIFY signal.
+    void invalidateManagedObject(const QString &appId) noexcept;
 
 public Q_SLOTS:
     QDBusObjectPath executeCommand(const QString &program,
@@ -105,6 +133,17 @@ public Q_SLOTS:
                      QDBusObjectPath &instance,
                      ObjectInterfaceMap &application_instance_info) const noexcept;
     void ReloadApplications();
+    ObjectInterfaceMap ListApplications(const QStringList &properties,
+                                        const QVariantMap &filter,
+                                        uint offset,
+                                        uint limit,
+                                        uint &total) const noexcept;
+    ObjectInterfaceMap GetLocalizedProperties(const QStringList &app_ids, const QString &locale) const noexcept;
+    qulonglong GetChangesSince(qulonglong since, bool &resync_required, ObjectChangeList &changes) const noexcept;
+    ObjectInterfaceMap GetLaunchLatency(const QString &app_id) const noexcept;
+    void ResetLaunchLatency() noexcept;
+    QVariantMap GetManagedObjectsCacheStats() const noexcept;
+    QVariantMap GetPropertiesChangedStats() const noexcept;
     QString addUserApplication(const QVariantMap &desktop_file, const QString &name) noexcept;
     void deleteUserApplication(const QString &app_id) noexcept;
     [[nodiscard]] ObjectMap GetManagedObjects() const;
@@ -113,9 +152,12 @@ Q_SIGNALS:
     void InterfacesAdded(const QDBusObjectPath &object_path, const ObjectInterfaceMap &interfaces);
     void InterfacesRemoved(const QDBusObjectPath &object_path, const QStringList &interfaces);
     void listChanged();
+    void ApplicationsChanged(const QStringList &added, const QStringList &removed, const QStringList &updated);
+    void RegistrySnapshotChanged(const QString &path, qulonglong generation);
 
 private Q_SLOTS:
     void doReloadApplications();
+    void onApplicationPropertyChanged();
 
 private:
     bool m_startupPhase{true};
@@ -126,19 +168,72 @@ private:
     std::unique_ptr<JobManager1Service> m_jobManager;
     QStringList m_hookElements;
     QStringList m_systemdPathEnv;
-    QFileSystemWatcher m_watcher;
+    RecursiveFileWatcher m_watcher;
     QTimer m_reloadTimer;
     bool m_isReloading{false};
     bool m_pendingReload{false};
+    bool m_fullReloadRequested{false};
+    // suppresses the per-object signals of applications added or removed by a reload.
+    bool m_batchedSignals{false};
+
+    // IDs of applications which changed during the running reload, announced together by ApplicationsChanged.
+    struct ApplicationsDelta
+    {
+        QSet<QString> added;
+        QSet<QString> removed;
+        QSet<QString> updated;
+
+        [[nodiscard]] bool isEmpty() const noexcept { return added.isEmpty() && removed.isEmpty() && updated.isEmpty(); }
+    };
+    std::optional<ApplicationsDelta> m_reloadDelta;
+    ChangeJournal m_changeJournal;
+    bool m_publishRegistry{false};
+    QTimer m_registryTimer;
+    QString m_registryPath{RegistrySnapshot::defaultPath()};
+    // interfaces and properties of every application as returned by GetManagedObjects, rebuilt on demand.
+    // NOTE: declared before m_applicationList, applications may still invalidate it while they're destroyed.
+    mutable QHash<QString, ObjectInterfaceMap> m_managedObjects;
+    mutable ManagedObjectsCacheStats m_managedObjectsStats;
+    // NOTE: declared before m_applicationList, it must outlive the registrations of applications.
+    std::unique_ptr<ApplicationObjectTree> m_objectTree;
     QHash<QString, QSharedPointer<ApplicationService>> m_applicationList;
+    DesktopEntryCache m_entryCache;
     QSharedPointer<CompatibilityManager> m_compatibilityManager;
     std::unique_ptr<PrelaunchSplashHelper> m_splashHelper;
+    std::unique_ptr<UnitLauncher> m_unitLauncher;
 
     void scanMimeInfos() noexcept;
     void scanApplications() noexcept;
     void scanInstances() noexcept;
     void updateAutostartStatus() noexcept;
     void loadHooks() noexcept;
+    void scheduleReload() noexcept;
+    void watchManagedObject(const ApplicationService *app) noexcept;
+    void reloadAllApplications() noexcept;
+    // rescans dirs and updates, adds or removes applications to match them, see reloadAllApplications.
+    void reloadApplicationsFrom(const QStringList &dirs) noexcept;
+    void reloadChangedApplications(const RecursiveFileWatcher::Changes &changes) noexcept;
+    void beginReloadTransaction() noexcept;
+    void finishReloadTransaction() noexcept;
+    void recordUpdatedApplication(const QString &appId) noexcept;
+    // journals properties of app which changed and refreshes the registry snapshot if it contains one of them.
+    void recordPropertiesChanged(const ApplicationService *app, const QStringList &properties) noexcept;
+    void scheduleRegistrySnapshot() noexcept;
+    void publishRegistrySnapshot() noexcept;
+
+    struct PendingApplication
+    {
+        DesktopFile file;
+        std::unique_ptr<DesktopEntry> entry{nullptr};
+        QSharedPointer<ApplicationService> existing{nullptr};
+        bool fromCache{false};
+        bool shown{false};
+    };
+    void loadApplications(std::vector<PendingApplication> pending) noexcept;
+    static void parsePendingApplication(PendingApplication &pending) noexcept;
+    void updateApplication(const QSharedPointer<ApplicationService> &destApp,
+                           DesktopFile desktopFile,
+                           std::unique_ptr<DesktopEntry> newEntry) noexcept;
     void onUnitNew(const QString &unitName, const QDBusObjectPath &systemdUnitPath) noexcept;
     void onUnitRemoved(const QString &unitName, const QDBusObjectPath &systemdUnitPath) noexcept;
     QSharedPointer<ApplicationService> addApplication(DesktopFile desktopFileSource, std::unique_ptr<DesktopEntry> entry) noexcept;
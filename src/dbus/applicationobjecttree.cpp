@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dbus/applicationobjecttree.h"
+#include "APPobjectmanager1adaptor.h"
+#include "applicationadaptor.h"
+#include "constant.h"
+#include "dbus/applicationmanager1service.h"
+#include "dbus/applicationservice.h"
+#include "global.h"
+#include <DUtil>
+#include <QDBusConnection>
+#include <QDBusError>
+#include <QDBusMetaType>
+#include <QDBusVariant>
+#include <QStringBuilder>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+// QtDBus only adds the standard interfaces to objects it exports itself.
+constexpr auto &StandardInterfacesXml = u"  <interface name=\"org.freedesktop.DBus.Properties\">\n"
+                                        "    <method name=\"Get\">\n"
+                                        "      <arg name=\"interface_name\" type=\"s\" direction=\"in\"/>\n"
+                                        "      <arg name=\"property_name\" type=\"s\" direction=\"in\"/>\n"
+                                        "      <arg name=\"value\" type=\"v\" direction=\"out\"/>\n"
+                                        "    </method>\n"
+                                        "    <method name=\"Set\">\n"
+                                        "      <arg name=\"interface_name\" type=\"s\" direction=\"in\"/>\n"
+                                        "      <arg name=\"property_name\" type=\"s\" direction=\"in\"/>\n"
+                                        "      <arg name=\"value\" type=\"v\" direction=\"in\"/>\n"
+                                        "    </method>\n"
+                                        "    <method name=\"GetAll\">\n"
+                                        "      <arg name=\"interface_name\" type=\"s\" direction=\"in\"/>\n"
+                                        "      <arg name=\"values\" type=\"a{sv}\" direction=\"out\"/>\n"
+                                        "      <annotation name=\"org.qtproject.QtDBus.QtTypeName.Out0\" value=\"QVariantMap\"/>\n"
+                                        "    </method>\n"
+                                        "    <signal name=\"PropertiesChanged\">\n"
+                                        "      <arg name=\"interface_name\" type=\"s\" direction=\"out\"/>\n"
+                                        "      <arg name=\"changed_properties\" type=\"a{sv}\" direction=\"out\"/>\n"
+                                        "      <annotation name=\"org.qtproject.QtDBus.QtTypeName.Out1\" value=\"QVariantMap\"/>\n"
+                                        "      <arg name=\"invalidated_properties\" type=\"as\" direction=\"out\"/>\n"
+                                        "    </signal>\n"
+                                        "  </interface>\n"
+                                        "  <interface name=\"org.freedesktop.DBus.Introspectable\">\n"
+                                        "    <method name=\"Introspect\">\n"
+                                        "      <arg name=\"xml_data\" type=\"s\" direction=\"out\"/>\n"
+                                        "    </method>\n"
+                                        "  </interface>\n"
+                                        "  <interface name=\"org.freedesktop.DBus.Peer\">\n"
+                                        "    <method name=\"Ping\"/>\n"
+                                        "    <method name=\"GetMachineId\">\n"
+                                        "      <arg name=\"machine_uuid\" type=\"s\" direction=\"out\"/>\n"
+                                        "    </method>\n"
+                                        "  </interface>\n";
+
+QString adaptorIntrospection(const QMetaObject &mo)
+{
+    const auto index = mo.indexOfClassInfo("D-Bus Introspection");
+    return index == -1 ? QString{} : QString::fromUtf8(mo.classInfo(index).value());
+}
+
+bool matches(const QDBusMessage &message, QStringView interface, QStringView member, qsizetype argumentCount) noexcept
+{
+    // the interface is optional in method calls.
+    return (message.interface().isEmpty() || message.interface() == interface) && message.member() == member &&
+           message.arguments().size() == argumentCount;
+}
+}  // namespace
+
+ApplicationObjectTree::ApplicationObjectTree(ApplicationManager1Service *service) noexcept
+    : m_service(service)
+{
+}
+
+QString ApplicationObjectTree::introspect(const QString &path) const
+{
+    Q_UNUSED(path)
+    // child nodes are appended by QtDBus.
+    static const QString xml = adaptorIntrospection(ApplicationAdaptor::staticMetaObject) %
+                               adaptorIntrospection(APPObjectManagerAdaptor::staticMetaObject) %
+                               fromStaticRaw(StandardInterfacesXml);
+    return xml;
+}
+
+bool ApplicationObjectTree::handleMessage(const QDBusMessage &message, const QDBusConnection &connection)
+{
+    auto reply = dispatch(message);
+    if (!reply) {
+        return false;
+    }
+
+    if (message.isReplyRequired() && !connection.send(reply.value())) {
+        qCWarning(DDEAM) << "couldn't reply" << message.member() << "of" << message.path();
+    }
+    return true;
+}
+
+QSharedPointer<ApplicationService> ApplicationObjectTree::applicationAt(const QString &path) const noexcept
+{
+    const auto &basePath = fromStaticRaw(DDEApplicationManager1ObjectPath);
+    if (path.size() <= basePath.size() + 1 || !path.startsWith(basePath) || path.at(basePath.size()) != u'/') {
+        return nullptr;
+    }
+
+    const auto escaped = QStringView{path}.sliced(basePath.size() + 1);
+    if (escaped.contains(u'/')) {
+        return nullptr;
+    }
+
+    return m_service->Applications().value(DUtil::unescapeFromObjectPath(escaped.toString()));
+}
+
+std::optional<QDBusMessage> ApplicationObjectTree::dispatch(const QDBusMessage &message) const noexcept
+{
+    if (message.type() != QDBusMessage::MethodCallMessage) {
+        return std::nullopt;
+    }
+
+    // hold a reference, a call may remove the application.
+    const auto app = applicationAt(message.path());
+    if (app.isNull()) {
+        return std::nullopt;
+    }
+
+    const auto &args = message.arguments();
+    const auto applicationInterface = fromStaticRaw(ApplicationInterface);
+    if (message.interface() == fromStaticRaw(SystemdPropInterfaceName)) {
+        return dispatchProperties(app, message);
+    }
+
+    if (matches(message, applicationInterface, u"Launch", 3)) {
+        std::optional<QDBusError> error;
+        const auto path =
+            app->launch(args.at(0).toString(), qdbus_cast<QStringList>(args.at(1)), qdbus_cast<QVariantMap>(args.at(2)), error);
+        if (error) {
+            return message.createErrorReply(*error);
+        }
+        return message.createReply(QVariant::fromValue(path));
+    }
+
+    if (matches(message, applicationInterface, u"SendToDesktop", 0)) {
+        return message.createReply(app->SendToDesktop());
+    }
+
+    if (matches(message, applicationInterface, u"RemoveFromDesktop", 0)) {
+        return message.createReply(app->RemoveFromDesktop());
+    }
+
+    if (matches(message, applicationInterface, u"GetLocalizedProperties", 1)) {
+        return message.createReply(app->GetLocalizedProperties(args.at(0).toString()));
+    }
+
+    if (matches(message, fromStaticRaw(ObjectManagerInterface), u"GetManagedObjects", 0)) {
+        return message.createReply(QVariant::fromValue(app->GetManagedObjects()));
+    }
+
+    if (message.interface() == applicationInterface || message.interface() == fromStaticRaw(ObjectManagerInterface)) {
+        return message.createErrorReply(
+            QDBusError::UnknownMethod, u"no method %1 with %2 arguments."_s.arg(message.member()).arg(args.size()));
+    }
+
+    return std::nullopt;
+}
+
+QDBusMessage ApplicationObjectTree::dispatchProperties(const QSharedPointer<ApplicationService> &app,
+                                                       const QDBusMessage &message) noexcept
+{
+    const auto &args = message.arguments();
+    const auto interface = args.isEmpty() ? QString{} : args.constFirst().toString();
+    const auto applicationInterface = fromStaticRaw(ApplicationInterface);
+    const bool isApplication = interface == applicationInterface;
+    if (!isApplication && interface != fromStaticRaw(ObjectManagerInterface)) {
+        return message.createErrorReply(QDBusError::UnknownInterface, u"unknown interface %1."_s.arg(interface));
+    }
+
+    if (matches(message, fromStaticRaw(SystemdPropInterfaceName), u"GetAll", 1)) {
+        return message.createReply(isApplication ? app->applicationInterfaceProperties() : QVariantMap{});
+    }
+
+    if (matches(message, fromStaticRaw(SystemdPropInterfaceName), u"Get", 2)) {
+        const auto name = args.at(1).toString();
+        const auto properties = isApplication ? app->applicationInterfaceProperties() : QVariantMap{};
+        if (auto it = properties.constFind(name); it != properties.cend()) {
+            return message.createReply(QVariant::fromValue(QDBusVariant{it.value()}));
+        }
+        return message.createErrorReply(QDBusError::UnknownProperty, u"unknown property %1."_s.arg(name));
+    }
+
+    if (matches(message, fromStaticRaw(SystemdPropInterfaceName), u"Set", 3)) {
+        const auto name = args.at(1).toString();
+        const auto value = args.at(2).value<QDBusVariant>().variant();
+        std::optional<QDBusError> error;
+        if (isApplication && name == u"AutoStart") {
+            error = app->writeAutoStart(value.toBool());
+        } else if (isApplication && name == u"MimeTypes") {
+            error = app->writeMimeTypes(qdbus_cast<QStringList>(value));
+        } else if (isApplication && name == u"Environ") {
+            error = app->writeEnviron(value.toString());
+        } else {
+            return message.createErrorReply(QDBusError::PropertyReadOnly, u"property %1 isn't writable."_s.arg(name));
+        }
+        return error ? message.createErrorReply(*error) : message.createReply();
+    }
+
+    return message.createErrorReply(QDBusError::UnknownMethod,
+                                    u"no method %1 with %2 arguments."_s.arg(message.member()).arg(args.size()));
+}
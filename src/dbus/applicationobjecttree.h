@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef APPLICATIONOBJECTTREE_H
+#define APPLICATIONOBJECTTREE_H
+
+#include <QDBusMessage>
+#include <QDBusVirtualObject>
+#include <QSharedPointer>
+#include <optional>
+
+class ApplicationManager1Service;
+class ApplicationService;
+
+// Serves the objects of applications without an adaptor pair and a registered QObject per application.
+// One instance is registered as a single node at every application path, calls are dispatched to the ApplicationService
+// of the path and properties are read from its typed getters. Instances below an application are regular objects.
+class ApplicationObjectTree : public QDBusVirtualObject
+{
+    Q_OBJECT
+public:
+    explicit ApplicationObjectTree(ApplicationManager1Service *service) noexcept;
+    ~ApplicationObjectTree() override = default;
+    ApplicationObjectTree(const ApplicationObjectTree &) = delete;
+    ApplicationObjectTree(ApplicationObjectTree &&) = delete;
+    ApplicationObjectTree &operator=(const ApplicationObjectTree &) = delete;
+    ApplicationObjectTree &operator=(ApplicationObjectTree &&) = delete;
+
+    [[nodiscard]] QString introspect(const QString &path) const override;
+    bool handleMessage(const QDBusMessage &message, const QDBusConnection &connection) override;
+
+private:
+    [[nodiscard]] QSharedPointer<ApplicationService> applicationAt(const QString &path) const noexcept;
+    // returns the reply of message, or nothing if it isn't ours and QtDBus should handle it, e.g. Introspect.
+    [[nodiscard]] std::optional<QDBusMessage> dispatch(const QDBusMessage &message) const noexcept;
+    [[nodiscard]] static QDBusMessage dispatchProperties(const QSharedPointer<ApplicationService> &app,
+                                                         const QDBusMessage &message) noexcept;
+
+    ApplicationManager1Service *m_service{nullptr};
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include "applicationmanagerstorage.h"
 #include "config.h"
 #include "constant.h"
+#include "dconfigcache.h"
 #include "eventreporter.h"
 #include "dbus/instanceadaptor.h"
 #include "desktopentry.h"
@@ -15,14 +16,15 @@
 #include "global.h"
 #include "iniParser.h"
 #include "launchoptions.h"
+#include "launchtracer.h"
 #include "prelaunchsplashhelper.h"
 #include "propertiesForwarder.h"
-#include <DConfig>
 #include <QDBusMessage>
 #include <QList>
 #include <QLoggingCategory>
 #include <QProcess>
 #include <QRegularExpression>
+#include <QScopedValueRollback>
 #include <QStandardPaths>
 #include <QStringList>
 #include <QUrl>
@@ -108,11 +110,58 @@ void unescapeEnvs(QVariantMap &options) noexcept
     options.insert(envKey, result);
 }
 
+QString mimeTypeValue(const DesktopEntry &entry) noexcept
+{
+    auto value = entry.value(fromStaticRaw(DesktopFileEntryKey), u"MimeType"_s);
+    return value ? toString(value->get()) : QString{};
+}
+
+// names of the Application properties derived from changed, X_linglong is left to the caller.
+QStringList changedPropertyNames(ApplicationProperties::Properties changed) noexcept
+{
+    static const std::pair<ApplicationProperties::Property, QString> names[]{
+        {ApplicationProperties::Categories, u"Categories"_s},
+        {ApplicationProperties::Actions, u"Actions"_s},
+        {ApplicationProperties::ActionName, u"ActionName"_s},
+        {ApplicationProperties::Name, u"Name"_s},
+        {ApplicationProperties::GenericName, u"GenericName"_s},
+        {ApplicationProperties::Icons, u"Icons"_s},
+        {ApplicationProperties::Execs, u"Execs"_s},
+        {ApplicationProperties::Terminal, u"Terminal"_s},
+        {ApplicationProperties::NoDisplay, u"NoDisplay"_s},
+        {ApplicationProperties::StartupWMClass, u"StartupWMClass"_s},
+        {ApplicationProperties::XFlatpak, u"X_Flatpak"_s},
+        {ApplicationProperties::XDeepinVendor, u"X_Deepin_Vendor"_s},
+        {ApplicationProperties::XDeepinCreateBy, u"X_Deepin_CreateBy"_s},
+        {ApplicationProperties::XCreatedBy, u"X_CreatedBy"_s},
+    };
+
+    QStringList ret;
+    for (const auto &[property, name] : names) {
+        if (changed.testFlag(property)) {
+            ret.append(name);
+        }
+    }
+    return ret;
+}
+
+// the untranslated value is used if there's no translation for locale.
+QString resolveLocaleString(const QStringMap &values, const QLocale &locale) noexcept
+{
+    if (auto ret = toLocaleString(QVariant::fromValue(values), locale); !ret.isEmpty()) {
+        return ret;
+    }
+
+    return unescapeValue(values.value(fromStaticRaw(DesktopFileDefaultKeyLocale)));
+}
+
+// clients usually ask for a few locales only, the limit is for callers cycling through many.
+constexpr qsizetype MaxCachedLocales = 8;
+
 }  // namespace
 
 void ApplicationService::appendExtraEnvironments(QVariantMap &runtimeOptions) const noexcept
 {
-    DCORE_USE_NAMESPACE
     QStringList envs;
     QStringList unsetEnvs;
 
@@ -132,20 +181,10 @@ void ApplicationService::appendExtraEnvironments(QVariantMap &runtimeOptions) co
         appendEnvs(*it, unsetEnvs);
     }
 
-    std::unique_ptr<DConfig> config(DConfig::create(fromStaticRaw(ApplicationServiceID),
-                                                    fromStaticRaw(ApplicationManagerConfig),
-                                                    u'/' % id()));  // $appid as subpath
-    if (config->isValid()) {
-        auto extraEnvs = config->value(fromStaticRaw(AppExtraEnvironments)).toStringList();
-        if (!extraEnvs.isEmpty()) {
-            envs.append(std::move(extraEnvs));
-        }
-
-        auto envsBlacklist = config->value(fromStaticRaw(AppEnvironmentsBlacklist)).toStringList();
-        if (!envsBlacklist.isEmpty()) {
-            unsetEnvs.append(std::move(envsBlacklist));
-        }
-    }
+    // read once per application and kept until its config changes.
+    const auto &extra = DConfigCache::instance().launchEnvironment(id());
+    envs.append(extra.envs);
+    unsetEnvs.append(extra.unsetEnvs);
 
     // it's useful for App to get itself AppId.
     envs.append(u"DSG_APP_ID="_s % id());
@@ -305,31 +344,49 @@ QSharedPointer<ApplicationService> ApplicationService::createApplicationService(
     QTextStream sourceStream;
 
     objectPath = getObjectPathFromAppId(app->desktopFileSource().desktopId());
-    if (!entry) {
-        DesktopFileGuard guard{app->desktopFileSource()};
 
-        if (!guard.try_open()) {
-            qDebug() << "open source desktop failed.";
-            return nullptr;
+    // an entry passed in by the caller has already gone through ApplicationFilter.
+    if (!entry) {
+        if (parent != nullptr) {
+            entry = parent->entryCache().find(app->desktopFileSource(), ApplicationEntryDecoding);
         }
 
-        entry = std::make_unique<DesktopEntry>();
-        auto error = entry->parse(app->desktopFileSource().sourceFileRef());
+        if (!entry) {
+            DesktopFileGuard guard{app->desktopFileSource()};
 
-        if (error != ParserError::NoError) {
-            qDebug() << "parse failed:" << error << app->desktopFileSource().sourcePath();
-            return nullptr;
+            if (!guard.try_open()) {
+                qDebug() << "open source desktop failed.";
+                return nullptr;
+            }
+
+            entry = std::make_unique<DesktopEntry>();
+            auto error = entry->parse(app->desktopFileSource().sourceFileRef(), ApplicationEntryDecoding);
+
+            if (error != ParserError::NoError) {
+                qDebug() << "parse failed:" << error << app->desktopFileSource().sourcePath();
+                return nullptr;
+            }
+
+            if (parent != nullptr) {
+                parent->entryCache().insert(app->desktopFileSource(), *entry);
+            }
         }
-    }
 
-    if (!shouldBeShown(entry)) {
-        qDebug() << "application shouldn't be shown:" << app->desktopFileSource().sourcePath();
-        return nullptr;
+        if (!shouldBeShown(entry)) {
+            qDebug() << "application shouldn't be shown:" << app->desktopFileSource().sourcePath();
+            return nullptr;
+        }
     }
 
     app->m_entry.reset(entry.release());
+    app->updateProperties();
     app->m_applicationPath = QDBusObjectPath{std::move(objectPath)};
 
+    // the object tree serves the object manager interface itself.
+    if (parent != nullptr && parent->objectTree() != nullptr) {
+        return app;
+    }
+
     // TODO: icon lookup
     if (auto *ptr = new (std::nothrow) APPObjectManagerAdaptor{app.data()}; ptr == nullptr) {
         qCritical() << "new Object Manager of Application failed.";
@@ -363,6 +420,21 @@ bool ApplicationService::shouldBeShown(const std::unique_ptr<DesktopEntry> &entr
 
 QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringList &fields, const QVariantMap &options)
 {
+    std::optional<QDBusError> error;
+    auto path = launch(action, fields, options, error);
+    if (error) {
+        safe_sendErrorReply(error->name(), error->message());
+    }
+    return path;
+}
+
+QDBusObjectPath ApplicationService::launch(const QString &action,
+                                           const QStringList &fields,
+                                           const QVariantMap &options,
+                                           std::optional<QDBusError> &error)
+{
+    const auto receivedAt = LaunchTracer::now();
+
     // Suppress splash for system autostart launches or singleton apps with existing instances.
     const bool isAutostartLaunch = options.value(fromStaticRaw(BuiltInAutostartOption), false).toBool();
 
@@ -380,7 +452,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
 
     if (isAutostartLaunch) {
         if (!parent()->isNewSession()) {
-            safe_sendErrorReply(QDBusError::Failed, "autostart launch has been ignored if not new session.");
+            error = QDBusError{QDBusError::Failed, "autostart launch has been ignored if not new session."};
         }
     }
 
@@ -411,7 +483,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
                    << "isAutostartLaunch:" << isAutostartLaunch
                    << "desktopSource:" << m_desktopSource.sourcePath()
                    << "autostartSource:" << m_autostartSource.m_filePath;
-        safe_sendErrorReply(QDBusError::Failed, msg);
+        error = QDBusError{QDBusError::Failed, msg};
         return {};
     }
 
@@ -441,7 +513,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
         if (!Actions) {
             const QString msg{"application can't be executed."};
             qWarning() << msg;
-            safe_sendErrorReply(QDBusError::Failed, msg);
+            error = QDBusError{QDBusError::Failed, msg};
             return {};
         }
 
@@ -449,7 +521,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
         if (execStr.isEmpty()) {
             const QString msg{"maybe entry actions's format is invalid, abort launch."};
             qWarning() << msg;
-            safe_sendErrorReply(QDBusError::Failed, msg);
+            error = QDBusError{QDBusError::Failed, msg};
             return {};
         }
     }
@@ -482,6 +554,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
 
     processCompatibility(action, optionsMap, execStr);
     unescapeEnvs(optionsMap);
+    const auto optionsAt = LaunchTracer::now();
 
     QString workingDir;
     if (auto entryPath = desktopEntry->value(fromStaticRaw(DesktopFileEntryKey), u"Path"_s); entryPath) {
@@ -497,15 +570,22 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
     auto cmds = generateCommand(optionsMap);
     auto task = processExec(execStr, fields);
     if (!task) {
-        safe_sendErrorReply(QDBusError::InternalError, "Invalid Command.");
+        error = QDBusError{QDBusError::InternalError, "Invalid Command."};
         return {};
     }
 
     if (task.LaunchBin.isEmpty()) {
         qCritical() << "error command is detected, abort.";
-        safe_sendErrorReply(QDBusError::Failed);
+        error = QDBusError{QDBusError::Failed, {}};
         return {};
     }
+    const auto execAt = LaunchTracer::now();
+
+    // validation passed, every launch from here on ends up in the trace.
+    auto &tracer = LaunchTracer::instance();
+    tracer.begin(instanceRandomUUID, id(), receivedAt);
+    tracer.mark(instanceRandomUUID, LaunchStage::Options, optionsAt);
+    tracer.mark(instanceRandomUUID, LaunchStage::Exec, execAt);
 
     if (terminal()) {
         // don't change this sequence
@@ -528,6 +608,7 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
             qCInfo(amPrelaunchSplash) << "Show prelaunch splash request" << id() << "instance" << instanceRandomUUID << "icon"
                                       << iconName;
             helper->show(id(), instanceRandomUUID, iconName);
+            tracer.mark(instanceRandomUUID, LaunchStage::SplashShown);
             m_splashInstanceIds.insert(instanceRandomUUID);
         } else {
             qCInfo(amPrelaunchSplash) << "Skip prelaunch splash (no helper instance)" << id();
@@ -538,89 +619,128 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
 
     m_pendingLaunchTypes.insert(instanceRandomUUID, launchType);
 
-    auto &jobManager = parent()->jobManager();
-    return jobManager.addJob(
-        m_applicationPath.path(),
-        [this, task, instanceRandomUUID = std::move(instanceRandomUUID), cmds = std::move(cmds), launchType, extraArgs = std::move(extraArgs)](
-            const QVariant &value) mutable -> QVariant {
-            QStringList newCommands;
-            const int estimatedSize = 6 + cmds.size() + task.command.size() + extraArgs.size() + (value.isValid() ? 1 : 0);
-            newCommands.reserve(estimatedSize);
-            newCommands
-                << QStringLiteral("--unitName=app-DDE-%1@%2.service").arg(escapeApplicationId(this->id()), instanceRandomUUID);
-            newCommands << QStringLiteral("--SyslogIdentifier=%1").arg(this->id());
-            newCommands << QStringLiteral("--SourcePath=%1").arg(m_desktopSource.sourcePath());
-            newCommands << std::move(cmds);
-
-            QStringList formattedRes;
-            if (!value.isNull()) {
-                if (value.canConvert<QStringList>()) {
-                    formattedRes = value.value<QStringList>();
-                } else {
-                    formattedRes.append(value.value<QString>());
-                }
+    // the command line of app-launch-helper for one resource, the in-process launcher accepts the same one.
+    auto commandLine = [this, task, instanceRandomUUID, cmds = std::move(cmds), extraArgs = std::move(extraArgs)](
+                           const QVariant &value) -> QStringList {
+        QStringList newCommands;
+        const int estimatedSize = 6 + cmds.size() + task.command.size() + extraArgs.size() + (value.isValid() ? 1 : 0);
+        newCommands.reserve(estimatedSize);
+        newCommands
+            << QStringLiteral("--unitName=app-DDE-%1@%2.service").arg(escapeApplicationId(this->id()), instanceRandomUUID);
+        newCommands << QStringLiteral("--SyslogIdentifier=%1").arg(this->id());
+        newCommands << QStringLiteral("--SourcePath=%1").arg(m_desktopSource.sourcePath());
+        newCommands << cmds;
+
+        auto argNum = task.argNum;
+        QStringList formattedRes;
+        if (!value.isNull()) {
+            if (value.canConvert<QStringList>()) {
+                formattedRes = value.value<QStringList>();
+            } else {
+                formattedRes.append(value.value<QString>());
+            }
 
-                if (task.local) {
-                    for (auto it = formattedRes.begin(); it != formattedRes.end();) {
-                        const QUrl url{*it};
-                        bool shouldErase = false;
+            if (task.local) {
+                for (auto it = formattedRes.begin(); it != formattedRes.end();) {
+                    const QUrl url{*it};
+                    bool shouldErase = false;
 
-                        if (!url.isValid()) {
-                            qWarning() << "Invalid resource URL, skipping:" << *it;
-                            shouldErase = true;
+                    if (!url.isValid()) {
+                        qWarning() << "Invalid resource URL, skipping:" << *it;
+                        shouldErase = true;
+                    } else {
+                        const auto scheme = url.scheme();
+                        if (scheme == "file") {
+                            *it = url.toLocalFile();
+                        } else if (scheme.isEmpty()) {
+                            // nothing to do
                         } else {
-                            const auto scheme = url.scheme();
-                            if (scheme == "file") {
-                                *it = url.toLocalFile();
-                            } else if (scheme.isEmpty()) {
-                                // nothing to do
-                            } else {
-                                // TODO: Remote file handling logic
-                                qWarning() << "Remote file not supported yet, skipping:" << *it;
-                                shouldErase = true;
-                            }
+                            // TODO: Remote file handling logic
+                            qWarning() << "Remote file not supported yet, skipping:" << *it;
+                            shouldErase = true;
                         }
+                    }
 
-                        if (shouldErase) {
-                            auto curLoc = std::distance(formattedRes.begin(), it);
-                            if (curLoc < task.argNum) {
-                                --task.argNum;
-                            }
-                            it = formattedRes.erase(it);
-                        } else {
-                            ++it;
+                    if (shouldErase) {
+                        auto curLoc = std::distance(formattedRes.begin(), it);
+                        if (curLoc < argNum) {
+                            --argNum;
                         }
+                        it = formattedRes.erase(it);
+                    } else {
+                        ++it;
                     }
                 }
             }
+        }
 
-            int originalIndex{0};
-            while (!task.command.isEmpty()) {
-                auto currentArg = task.command.takeFirst();
+        for (qsizetype originalIndex = 0; originalIndex < task.command.size(); ++originalIndex) {
+            auto currentArg = task.command[originalIndex];
 
-                if (originalIndex != task.argNum) {
-                    newCommands << std::move(currentArg);
-                } else {
-                    if (task.fieldLocation != -1) {
-                        if (formattedRes.size() > 1) {
-                            qWarning() << "multiple resources are found, only the first one will be used.";
-                        }
+            if (originalIndex != argNum) {
+                newCommands << std::move(currentArg);
+            } else {
+                if (task.fieldLocation != -1) {
+                    if (formattedRes.size() > 1) {
+                        qWarning() << "multiple resources are found, only the first one will be used.";
+                    }
 
-                        currentArg.replace(task.fieldLocation, 2, formattedRes.isEmpty() ? QString{} : formattedRes.takeFirst());
-                        newCommands << std::move(currentArg);
+                    currentArg.replace(task.fieldLocation, 2, formattedRes.isEmpty() ? QString{} : formattedRes.takeFirst());
+                    newCommands << std::move(currentArg);
 
-                        if (!formattedRes.isEmpty()) {
-                            newCommands << std::move(formattedRes);
-                        }
-                    } else {
+                    if (!formattedRes.isEmpty()) {
                         newCommands << std::move(formattedRes);
                     }
+                } else {
+                    newCommands << std::move(formattedRes);
                 }
-
-                ++originalIndex;
             }
+        }
+
+        newCommands << extraArgs;
+        return newCommands;
+    };
 
-            newCommands << std::move(extraArgs);
+    auto launchFailed = [this, launchType, instanceRandomUUID](const QString &reason) {
+        qWarning() << "Launch Application Failed";
+        EventReporter::instance().reportAppLaunchFailed(eventAppId(), reason, x_linglong(), launchType, instanceRandomUUID);
+        LaunchTracer::instance().fail(instanceRandomUUID, reason);
+        m_pendingLaunchTypes.remove(instanceRandomUUID);
+    };
+    const QString instancePath{m_applicationPath.path() % u'/' % instanceRandomUUID};
+
+    auto &jobManager = parent()->jobManager();
+    QDBusObjectPath jobPath;
+    if (auto *launcher = parent()->unitLauncher(); launcher != nullptr) {
+        jobPath = jobManager.addAsyncJob(
+            m_applicationPath.path(),
+            [this,
+             launcher,
+             commandLine = std::move(commandLine),
+             launchFailed = std::move(launchFailed),
+             instancePath,
+             instanceRandomUUID](const QVariant &value) {
+                auto launched = [launchFailed, instancePath, instanceRandomUUID](const QString &result) -> QVariant {
+                    if (result != u"done") {
+                        launchFailed(QStringLiteral("transient unit finished with result %1").arg(result));
+                        return QDBusError::Failed;
+                    }
+
+                    LaunchTracer::instance().mark(instanceRandomUUID, LaunchStage::UnitStarted);
+                    return instancePath;
+                };
+                return launcher->launch(commandLine(value)).then(this, std::move(launched));
+            },
+            task.Resources);
+        tracer.mark(instanceRandomUUID, LaunchStage::Scheduled);
+        return jobPath;
+    }
+
+    jobPath = jobManager.addJob(
+        m_applicationPath.path(),
+        [commandLine = std::move(commandLine), launchFailed = std::move(launchFailed), instancePath, instanceRandomUUID](
+            const QVariant &value) -> QVariant {
+            const auto newCommands = commandLine(value);
 
             QProcess process;
             const auto &bin = getApplicationLauncherBinary();
@@ -630,19 +750,16 @@ QDBusObjectPath ApplicationService::Launch(const QString &action, const QStringL
             process.waitForFinished();
             auto exitCode = process.exitCode();
             if (exitCode != 0) {
-                qWarning() << "Launch Application Failed";
-                EventReporter::instance().reportAppLaunchFailed(eventAppId(),
-                                                     QStringLiteral("app-launch-helper exited with code %1").arg(exitCode),
-                                                     x_linglong(),
-                                                     launchType,
-                                                     instanceRandomUUID);
-                m_pendingLaunchTypes.remove(instanceRandomUUID);
+                launchFailed(QStringLiteral("app-launch-helper exited with code %1").arg(exitCode));
                 return QDBusError::Failed;
             }
 
-            return QString{m_applicationPath.path() % u'/' % instanceRandomUUID};
+            LaunchTracer::instance().mark(instanceRandomUUID, LaunchStage::UnitStarted);
+            return instancePath;
         },
         std::move(task.Resources));
+    tracer.mark(instanceRandomUUID, LaunchStage::Scheduled);
+    return jobPath;
 }
 
 bool ApplicationService::SendToDesktop() const noexcept
@@ -667,6 +784,41 @@ bool ApplicationService::SendToDesktop() const noexcept
     return success;
 }
 
+QVariantMap ApplicationService::GetLocalizedProperties(const QString &locale) const noexcept
+{
+    return localizedProperties(locale.isEmpty() ? getUserLocale() : QLocale{locale});
+}
+
+QVariantMap ApplicationService::localizedProperties(const QLocale &locale) const noexcept
+{
+    if (m_localizedVersion != m_properties->version) {
+        m_localizedProperties.clear();
+        m_localizedVersion = m_properties->version;
+    }
+
+    const auto key = locale.name();
+    if (auto it = m_localizedProperties.constFind(key); it != m_localizedProperties.cend()) {
+        return it.value();
+    }
+
+    QStringMap actionName;
+    for (auto it = m_properties->actionName.cbegin(); it != m_properties->actionName.cend(); ++it) {
+        actionName.insert(it.key(), resolveLocaleString(it.value(), locale));
+    }
+
+    const QVariantMap ret{
+        {u"Name"_s, resolveLocaleString(m_properties->name, locale)},
+        {u"GenericName"_s, resolveLocaleString(m_properties->genericName, locale)},
+        {u"ActionName"_s, QVariant::fromValue(actionName)},
+    };
+
+    if (m_localizedProperties.size() >= MaxCachedLocales) {
+        m_localizedProperties.clear();
+    }
+    m_localizedProperties.insert(key, ret);
+    return ret;
+}
+
 bool ApplicationService::RemoveFromDesktop() const noexcept
 {
     if (!isOnDesktop()) {
@@ -709,96 +861,112 @@ bool ApplicationService::isOnDesktop() const noexcept
 
 bool ApplicationService::noDisplay() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"NoDisplay"_s, EntryValueType::Boolean);
-
-    if (val.isNull()) {
-        return false;
-    }
-
-    return val.toBool();
+    return m_properties->noDisplay;
 }
 
 QStringList ApplicationService::actions() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), fromStaticRaw(DesktopEntryActions), EntryValueType::String);
-
-    if (val.isNull()) {
-        return {};
-    }
-
-    return toString(val).split(u';', Qt::SkipEmptyParts);
+    return m_properties->actions;
 }
 
 QStringList ApplicationService::categories() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"Categories"_s, EntryValueType::String);
-
-    if (val.isNull()) {
-        return {};
-    }
-
-    return val.toString().split(u';', Qt::SkipEmptyParts);
+    return m_properties->categories;
 }
 
 PropMap ApplicationService::actionName() const noexcept
 {
-    PropMap ret;
-    const auto &actionList = actions();
-
-    for (const auto &action : actionList) {
-        const QString rawActionKey = fromStaticRaw(DesktopFileActionKey) % action;
-        auto value = m_entry->value(rawActionKey, fromStaticRaw(DesktopEntryName));
-        if (!value.has_value()) {
-            continue;
-        }
-        ret.insert(action, value->get().value<QStringMap>());
-    }
-
-    return ret;
+    return m_properties->actionName;
 }
 
 QStringMap ApplicationService::name() const noexcept
 {
-    auto value = m_entry->value(fromStaticRaw(DesktopFileEntryKey), fromStaticRaw(DesktopEntryName));
-    if (!value) {
-        return {};
-    }
-
-    return value->get().value<QStringMap>();
+    return m_properties->name;
 }
 
 QStringMap ApplicationService::genericName() const noexcept
 {
-    auto value = m_entry->value(fromStaticRaw(DesktopFileEntryKey), u"GenericName"_s);
-    if (!value) {
-        return {};
-    }
-
-    return value->get().value<QStringMap>();
+    return m_properties->genericName;
 }
 
 QStringMap ApplicationService::icons() const noexcept
 {
-    QStringMap ret;
-    const auto &actionList = actions();
-    for (const auto &action : std::as_const(actionList)) {
-        auto actionKey = QString{action}.prepend(fromStaticRaw(DesktopFileActionKey));
-        auto value = m_entry->value(actionKey, u"Icon"_s);
-        if (!value) {
+    return m_properties->icons;
+}
+
+ObjectInterfaceMap ApplicationService::interfacesAndProperties() const noexcept
+{
+    const auto applicationInterface = fromStaticRaw(ApplicationInterface);
+    if (isServedByObjectTree()) {
+        return ObjectInterfaceMap{{applicationInterface, applicationInterfaceProperties()},
+                                  {fromStaticRaw(ObjectManagerInterface), QVariantMap{}}};
+    }
+
+    ObjectInterfaceMap ret;
+    for (const auto *child : children()) {
+        if (qobject_cast<const QDBusAbstractAdaptor *>(child) == nullptr) {
             continue;
         }
 
-        ret.insert(actionKey, value->get().value<QString>());
-    }
+        const auto &interface = getDBusInterface(child->metaObject());
+        if (Q_UNLIKELY(interface.isEmpty())) {
+            continue;
+        }
 
-    auto mainIcon = m_entry->value(fromStaticRaw(DesktopFileEntryKey), u"Icon"_s);
-    if (mainIcon) {
-        ret.insert(fromStaticRaw(DesktopFileEntryKey), mainIcon->get().value<QString>());
+        ret.insert(interface, interface == applicationInterface ? applicationInterfaceProperties()
+                                                                : getPropertiesFromAdaptor(child));
     }
 
     return ret;
 }
 
+QStringList ApplicationService::interfaces() const noexcept
+{
+    if (isServedByObjectTree()) {
+        return {fromStaticRaw(ApplicationInterface), fromStaticRaw(ObjectManagerInterface)};
+    }
+
+    return getChildInterfacesFromObject(this);
+}
+
+bool ApplicationService::isServedByObjectTree() const noexcept
+{
+    const auto *am = parent();
+    return am != nullptr && am->objectTree() != nullptr;
+}
+
+QVariantMap ApplicationService::applicationInterfaceProperties() const noexcept
+{
+    // keep in sync with api/dbus/org.desktopspec.ApplicationManager1.Application.xml, the types are the adaptor's.
+    return QVariantMap{
+        {u"ActionName"_s, QVariant::fromValue(actionName())},
+        {u"Actions"_s, actions()},
+        {u"AutoStart"_s, isAutoStart()},
+        {u"Categories"_s, categories()},
+        {u"DesktopSourcePath"_s, desktopSourcePath()},
+        {u"Environ"_s, environ()},
+        {u"Execs"_s, QVariant::fromValue(execs())},
+        {u"GenericName"_s, QVariant::fromValue(genericName())},
+        {u"ID"_s, id()},
+        {u"Icons"_s, QVariant::fromValue(icons())},
+        {u"InstalledTime"_s, QVariant::fromValue<qlonglong>(installedTime())},
+        {u"Instances"_s, QVariant::fromValue(instances())},
+        {u"LastLaunchedTime"_s, QVariant::fromValue<qlonglong>(lastLaunchedTime())},
+        {u"LaunchedTimes"_s, QVariant::fromValue<qlonglong>(launchedTimes())},
+        {u"MimeTypes"_s, mimeTypes()},
+        {u"Name"_s, QVariant::fromValue(name())},
+        {u"NoDisplay"_s, noDisplay()},
+        {u"StartupWMClass"_s, startupWMClass()},
+        {u"Terminal"_s, terminal()},
+        {u"X_CreatedBy"_s, X_CreatedBy()},
+        {u"X_Deepin_CreateBy"_s, X_Deepin_CreateBy()},
+        {u"X_Deepin_Vendor"_s, X_Deepin_Vendor()},
+        {u"X_Flatpak"_s, x_Flatpak()},
+        {u"X_linglong"_s, x_linglong()},
+        {u"isOnDesktop"_s, isOnDesktop()},
+    };
+}
+
 ObjectMap ApplicationService::GetManagedObjects() const
 {
     return dumpDBusObject(m_Instances);
@@ -811,58 +979,37 @@ const QString &ApplicationService::id() const noexcept
 
 bool ApplicationService::x_Flatpak() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"X-flatpak"_s, EntryValueType::String);
-    return !val.isNull();
+    return m_properties->xFlatpak;
 }
 
 bool ApplicationService::x_linglong() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"X-linglong"_s, EntryValueType::String);
-    return !val.isNull();
+    return !m_properties->xLinglongAppId.isEmpty();
 }
 
 QString ApplicationService::X_linglongAppId() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"X-linglong"_s, EntryValueType::String);
-    return val.isNull() ? QString{} : val.toString();
+    return m_properties->xLinglongAppId;
 }
 
 QString ApplicationService::X_Deepin_Vendor() const noexcept
 {
-    return findEntryValue(fromStaticRaw(DesktopFileEntryKey), u"X-Deepin-Vendor"_s, EntryValueType::String).toString();
+    return m_properties->xDeepinVendor;
 }
 
 QString ApplicationService::X_Deepin_CreateBy() const noexcept
 {
-    return findEntryValue(fromStaticRaw(DesktopFileEntryKey), fromStaticRaw(DesktopEntryXDeepinCreateBy), EntryValueType::String)
-        .toString();
+    return m_properties->xDeepinCreateBy;
 }
 
 QStringMap ApplicationService::execs() const noexcept
 {
-    QStringMap ret;
-
-    auto mainExec = m_entry->value(fromStaticRaw(DesktopFileEntryKey), "Exec");
-    if (mainExec.has_value()) {
-        ret.insert(fromStaticRaw(DesktopFileEntryKey), mainExec->get().value<QString>());
-    }
-
-    const auto &actionList = actions();
-    for (const auto &action : std::as_const(actionList)) {
-        auto actionKey = QString{action}.prepend(fromStaticRaw(DesktopFileActionKey));
-        auto value = m_entry->value(actionKey, "Exec");
-        if (!value.has_value()) {
-            continue;
-        }
-        ret.insert(actionKey, value->get().value<QString>());
-    }
-
-    return ret;
+    return m_properties->execs;
 }
 
 QString ApplicationService::X_CreatedBy() const noexcept
 {
-    return findEntryValue(fromStaticRaw(DesktopFileEntryKey), "X-Created-By", EntryValueType::String).toString();
+    return m_properties->xCreatedBy;
 }
 
 QString ApplicationService::desktopSourcePath() const noexcept
@@ -872,17 +1019,12 @@ QString ApplicationService::desktopSourcePath() const noexcept
 
 bool ApplicationService::terminal() const noexcept
 {
-    auto val = findEntryValue(fromStaticRaw(DesktopFileEntryKey), "Terminal", EntryValueType::String);
-    if (!val.isNull()) {
-        return val.toBool();
-    }
-    return false;
+    return m_properties->terminal;
 }
 
 QString ApplicationService::startupWMClass() const noexcept
 {
-    auto value = findEntryValue(fromStaticRaw(DesktopFileEntryKey), "StartupWMClass", EntryValueType::String);
-    return value.isNull() ? QString{} : value.toString();
+    return m_properties->startupWMClass;
 }
 
 qint64 ApplicationService::installedTime() const noexcept
@@ -906,34 +1048,40 @@ QString ApplicationService::environ() const noexcept
 }
 
 void ApplicationService::setEnviron(const QString &value) noexcept
+{
+    if (auto error = writeEnviron(value); error) {
+        safe_sendErrorReply(error->name(), error->message());
+    }
+}
+
+std::optional<QDBusError> ApplicationService::writeEnviron(const QString &value) noexcept
 {
     if (environ().trimmed() == value.trimmed()) {
-        return;
+        return std::nullopt;
     }
 
     auto storagePtr = m_storage.lock();
     if (!storagePtr) {
         qCritical() << "broken storage.";
-        safe_sendErrorReply(QDBusError::InternalError);
-        return;
+        return QDBusError{QDBusError::InternalError, {}};
     }
 
     auto appId = id();
     if (!storagePtr->readApplicationValue(appId, fromStaticRaw(ApplicationPropertiesGroup), fromStaticRaw(Environ)).isNull()) {
         if (!storagePtr->updateApplicationValue(
                 appId, fromStaticRaw(ApplicationPropertiesGroup), fromStaticRaw(Environ), value)) {
-            safe_sendErrorReply(QDBusError::Failed, "update environ failed.");
-            return;
+            return QDBusError{QDBusError::Failed, "update environ failed."};
         }
     } else {
         if (!storagePtr->createApplicationValue(
                 appId, fromStaticRaw(ApplicationPropertiesGroup), fromStaticRaw(Environ), value)) {
-            safe_sendErrorReply(QDBusError::Failed, "set environ failed.");
+            return QDBusError{QDBusError::Failed, "set environ failed."};
         }
     }
 
     m_environ = value;
     emit environChanged();
+    return std::nullopt;
 }
 
 bool ApplicationService::autostartCheck() const noexcept
@@ -988,13 +1136,20 @@ bool ApplicationService::saveAutostartEntry(const QString &fileName, const Deskt
         return false;
     }
 
+    auto content = toString(entry.data()).toLocal8Bit();
+
+    // every write raises IN_CLOSE_WRITE in a watched autostart directory and schedules another reload,
+    // which would sync the generated entry again.
+    if (QFile current{fileName}; current.open(QFile::ReadOnly) && current.readAll() == content) {
+        return true;
+    }
+
     QFile autostartFile{fileName};
     if (!autostartFile.open(QFile::WriteOnly | QFile::Text | QFile::Truncate)) {
         qWarning() << "open file" << fileName << "failed:" << autostartFile.error();
         return false;
     }
 
-    auto content = toString(entry.data()).toLocal8Bit();
     auto writeBytes = autostartFile.write(content);
 
     if (writeBytes != content.size() || !autostartFile.flush()) {
@@ -1045,22 +1200,27 @@ void ApplicationService::syncGeneratedAutostartEntry() noexcept
 }
 
 void ApplicationService::setAutoStart(bool autostart) noexcept
+{
+    if (auto error = writeAutoStart(autostart); error) {
+        safe_sendErrorReply(error->name(), error->message());
+    }
+}
+
+std::optional<QDBusError> ApplicationService::writeAutoStart(bool autostart) noexcept
 {
     if (isAutoStart() == autostart) {
-        return;
+        return std::nullopt;
     }
 
     if (!m_entry) {
         qWarning() << "set autostart failed, desktop entry is null:" << id();
-        safe_sendErrorReply(QDBusError::InternalError);
-        return;
+        return QDBusError{QDBusError::InternalError, {}};
     }
 
     const QDir startDir(getAutoStartDirs().constFirst());
     if (!startDir.exists() && !startDir.mkpath(startDir.path())) {
         qWarning() << "mkpath " << startDir.path() << "failed";
-        safe_sendErrorReply(QDBusError::InternalError);
-        return;
+        return QDBusError{QDBusError::InternalError, {}};
     }
 
     auto fileName = startDir.filePath(m_desktopSource.desktopId() % desktopSuffix);
@@ -1087,12 +1247,12 @@ void ApplicationService::setAutoStart(bool autostart) noexcept
 
     if (!saveAutostartEntry(fileName, newEntry)) {
         qWarning() << "set autostart failed:" << id() << "autostart:" << autostart << "file:" << fileName;
-        safe_sendErrorReply(QDBusError::Failed);
-        return;
+        return QDBusError{QDBusError::Failed, {}};
     }
 
     setAutostartSource({fileName, newEntry});
     emit autostartChanged();
+    return std::nullopt;
 }
 
 QStringList ApplicationService::mimeTypes() const noexcept
@@ -1142,6 +1302,13 @@ QStringList ApplicationService::mimeTypes() const noexcept
 }
 
 void ApplicationService::setMimeTypes(const QStringList &value) noexcept
+{
+    if (auto error = writeMimeTypes(value); error) {
+        safe_sendErrorReply(error->name(), error->message());
+    }
+}
+
+std::optional<QDBusError> ApplicationService::writeMimeTypes(const QStringList &value) noexcept
 {
     auto oldMimes = mimeTypes();
     auto newMimes = value;
@@ -1159,16 +1326,14 @@ void ApplicationService::setMimeTypes(const QStringList &value) noexcept
     auto userInfo =
         std::find_if(infos.begin(), infos.end(), [&userDir](const MimeInfo &info) { return info.directory() == userDir; });
     if (userInfo == infos.cend()) {
-        safe_sendErrorReply(QDBusError::Failed, "user-specific config file doesn't exists.");
-        return;
+        return QDBusError{QDBusError::Failed, "user-specific config file doesn't exists."};
     }
 
     auto &userAppsList = userInfo->appsList();
     auto list = std::find_if(
         userAppsList.begin(), userAppsList.end(), [](const MimeApps &config) { return !config.isDesktopSpecific(); });
     if (list == userAppsList.end()) {
-        safe_sendErrorReply(QDBusError::Failed, "user-specific config file doesn't exists.");
-        return;
+        return QDBusError{QDBusError::Failed, "user-specific config file doesn't exists."};
     }
     const auto &appId = id();
     for (const auto &add : std::as_const(newAdds)) {
@@ -1178,11 +1343,14 @@ void ApplicationService::setMimeTypes(const QStringList &value) noexcept
         list->removeAssociation(remove, appId);
     }
 
+    // the associations in memory are changed anyway.
+    emit MimeTypesChanged();
     if (!list->writeToFile()) {
         qWarning() << "error occurred when write mime association to file";
+        return QDBusError{QDBusError::Failed, "write mime association failed."};
     }
 
-    emit MimeTypesChanged();
+    return std::nullopt;
 }
 
 QList<QDBusObjectPath> ApplicationService::instances() const noexcept
@@ -1215,12 +1383,22 @@ bool ApplicationService::addOneInstance(const QString &instanceId,
     }
 
     m_Instances.insert(QDBusObjectPath{objectPath}, QSharedPointer<InstanceService>{service});
+    // an orphaned instance outlives its application, the manager keeps journaling it.
+    if (auto *am = parent(); am != nullptr) {
+        connect(service, &InstanceService::orphanedChanged, am, [am, path = QDBusObjectPath{objectPath}] {
+            if (!am->isStartupPhase()) {
+                am->changeJournal().record(ObjectChange::PropertiesChanged, path, {u"Orphaned"_s});
+            }
+        });
+    }
     service->moveToThread(this->thread());
     adaptor->moveToThread(this->thread());
+    invalidateManagedObject();
 
     if (!parent()->isStartupPhase()) {
         const auto dbusObjectPath = QDBusObjectPath{objectPath};
         const auto interfaces = getChildInterfacesAndPropertiesFromObject(service);
+        parent()->changeJournal().record(ObjectChange::ObjectAdded, dbusObjectPath);
         emit InterfacesAdded(dbusObjectPath, interfaces);
         sendObjectManagerSignal(m_applicationPath.path(),
                                 "InterfacesAdded",
@@ -1236,10 +1414,14 @@ void ApplicationService::removeOneInstance(const QDBusObjectPath &instance) noex
     if (auto it = m_Instances.constFind(instance); it != m_Instances.cend()) {
         closeSplashForInstance(it.value()->instanceId());
         const auto interfaces = getChildInterfacesFromObject(it->data());
+        if (auto *am = parent(); am != nullptr && !am->isStartupPhase()) {
+            am->changeJournal().record(ObjectChange::ObjectRemoved, instance);
+        }
         emit InterfacesRemoved(instance, interfaces);
         sendObjectManagerSignal(m_applicationPath.path(), "InterfacesRemoved", instance, QVariant::fromValue(interfaces));
         unregisterObjectFromDBus(instance.path());
         m_Instances.remove(instance);
+        invalidateManagedObject();
     }
 }
 
@@ -1271,6 +1453,8 @@ void ApplicationService::handleUnitStarted(const QString &instanceId,
 
     if (!addOneInstance(instanceId, m_applicationPath.path(), systemdUnitPath, launcher, lt)) {
         qCCritical(DDEAM) << "failed to add instance" << systemdUnitPath << "to app" << id();
+    } else {
+        LaunchTracer::instance().mark(instanceId, LaunchStage::InstanceAdded);
     }
 
     auto watcher = new UnitResultWatcher(QDBusObjectPath{systemdUnitPath}, this);
@@ -1349,15 +1533,28 @@ void ApplicationService::detachAllInstance() noexcept
         instance->setProperty("Orphaned", true);
     }
 
-    m_Instances.clear();
+    if (!m_Instances.isEmpty()) {
+        m_Instances.clear();
+        invalidateManagedObject();
+        emit instanceChanged();
+    }
     closeAllSplashes();
 }
 
+void ApplicationService::invalidateManagedObject() noexcept
+{
+    // Instances has a NOTIFY signal, but instance changes are announced by InterfacesAdded/Removed instead.
+    if (auto *am = parent()) {
+        am->invalidateManagedObject(id());
+    }
+}
+
 void ApplicationService::closeSplashForInstance(const QString &instanceId) noexcept
 {
     if (!m_splashInstanceIds.remove(instanceId)) {
         return;
     }
+    LaunchTracer::instance().mark(instanceId, LaunchStage::SplashClosed);
 
     if (auto *am = parent()) {
         if (auto *helper = am->splashHelper()) {
@@ -1389,32 +1586,97 @@ QDBusObjectPath ApplicationService::findInstance(const QString &instanceId) cons
     return {};
 }
 
+ApplicationProperties::Properties ApplicationService::updateProperties() noexcept
+{
+    if (!m_entry) {
+        return ApplicationProperties::NoProperty;
+    }
+
+    auto properties = ApplicationProperties::fromEntry(*m_entry, m_properties->version + 1);
+    const auto changed = properties->diff(*m_properties);
+    // keep the current snapshot and its version if nothing changed, so readers don't see a spurious update.
+    if (changed.toInt() != 0U || m_properties->version == 0) {
+        m_properties = std::move(properties);
+    }
+
+    return changed;
+}
+
 void ApplicationService::resetEntry(DesktopEntry *newEntry) noexcept
 {
+    // only properties derived from the entry can change here, launch statistics, environ and instances can't.
+    const bool wasAutoStart = isAutoStart();
+    const bool wasLinglong = x_linglong();
+    const auto oldMimeTypes = m_entry ? mimeTypeValue(*m_entry) : QString{};
+
     m_entry.reset(newEntry);
-    emit autostartChanged();
-    emit noDisplayChanged();
-    emit isOnDesktopChanged();
-    emit installedTimeChanged();
-    emit x_FlatpakChanged();
-    emit x_linglongChanged();
-    emit instanceChanged();
-    emit lastLaunchedTimeChanged();
-    emit iconsChanged();
-    emit nameChanged();
-    emit genericNameChanged();
-    emit actionNameChanged();
-    emit actionsChanged();
-    emit categoriesChanged();
-    emit MimeTypesChanged();
-    emit terminalChanged();
-    emit environChanged();
-    emit launchedTimesChanged();
-    emit startupWMClassChanged();
-    emit xDeepinCreatedByChanged();
-    emit execsChanged();
-    emit xCreatedByChanged();
-    emit desktopSourcePathChanged();
+    const auto changed = updateProperties();
+    auto properties = changedPropertyNames(changed);
+    // the notifications below are journaled at once from the diff, which covers properties without one as well.
+    const QScopedValueRollback resetting{m_resettingEntry, true};
+    // not every property has a NOTIFY signal, e.g. X_Deepin_Vendor, drop the cached managed object directly.
+    if (changed.toInt() != 0U) {
+        invalidateManagedObject();
+    }
+
+    if (changed.testFlag(ApplicationProperties::NoDisplay)) {
+        emit noDisplayChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::XFlatpak)) {
+        emit x_FlatpakChanged();
+    }
+    // X_linglong only tells whether there is an ID, the ID itself isn't a property with a notification.
+    if (changed.testFlag(ApplicationProperties::XLinglong) && x_linglong() != wasLinglong) {
+        properties.append(u"X_linglong"_s);
+        emit x_linglongChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Icons)) {
+        emit iconsChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Name)) {
+        emit nameChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::GenericName)) {
+        emit genericNameChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::ActionName)) {
+        emit actionNameChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Actions)) {
+        emit actionsChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Categories)) {
+        emit categoriesChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Terminal)) {
+        emit terminalChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::StartupWMClass)) {
+        emit startupWMClassChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::XDeepinCreateBy)) {
+        emit xDeepinCreatedByChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::Execs)) {
+        emit execsChanged();
+    }
+    if (changed.testFlag(ApplicationProperties::XCreatedBy)) {
+        emit xCreatedByChanged();
+    }
+
+    // AutoStart falls back to Hidden of the entry if there is no autostart entry.
+    if (isAutoStart() != wasAutoStart) {
+        properties.append(u"AutoStart"_s);
+        emit autostartChanged();
+    }
+    if (mimeTypeValue(*m_entry) != oldMimeTypes) {
+        properties.append(u"MimeTypes"_s);
+        emit MimeTypesChanged();
+    }
+
+    if (auto *am = parent(); am != nullptr) {
+        am->recordPropertiesChanged(this, properties);
+    }
 }
 
 enum class SpliterState : uint8_t { Normal, InSingleQuote, InDoubleQuotes };
@@ -1669,36 +1931,7 @@ QVariant ApplicationService::findEntryValue(const QString &group,
         return {};
     }
 
-    const auto &val = std::move(tmp).value().get();
-    switch (type) {
-    case EntryValueType::Raw: {
-        auto valStr = toString(val, true);
-        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
-    }
-    case EntryValueType::String: {
-        auto valStr = toString(val);
-        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
-    }
-    case EntryValueType::LocaleString: {
-        auto valStr = toLocaleString(val, locale);
-        if (valStr.isEmpty()) {
-            valStr = toString(val);
-        }
-
-        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
-    }
-    case EntryValueType::Boolean: {
-        bool ok{false};
-        auto valBool = toBoolean(val, ok);
-        return ok ? valBool : QVariant{};
-    }
-    case EntryValueType::IconString: {
-        auto valStr = toIconString(val);
-        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
-    }
-    }
-
-    Q_UNREACHABLE();
+    return toTypedValue(tmp->get(), type, locale);
 }
 
 void ApplicationService::updateAfterLaunch(bool isLaunch) noexcept
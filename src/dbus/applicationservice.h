@@ -7,12 +7,14 @@
 
 #include "applicationmanager1service.h"
 #include "applicationmanagerstorage.h"
+#include "applicationproperties.h"
 #include "dbus/applicationmanager1service.h"
 #include "dbus/instanceservice.h"
 #include "dbus/jobmanager1service.h"
 #include "desktopentry.h"
 #include "global.h"
 #include <QDBusContext>
+#include <QDBusError>
 #include <QDBusObjectPath>
 #include <QDBusUnixFileDescriptor>
 #include <QFile>
@@ -23,6 +25,7 @@
 #include <QTextStream>
 #include <QUuid>
 #include <memory>
+#include <optional>
 
 struct AutostartSource
 {
@@ -70,6 +73,8 @@ public:
     Q_PROPERTY(QString Environ READ environ WRITE setEnviron NOTIFY environChanged)
     [[nodiscard]] QString environ() const noexcept;
     void setEnviron(const QString &value) noexcept;
+    // the error a D-Bus caller gets, std::nullopt on success.
+    [[nodiscard]] std::optional<QDBusError> writeEnviron(const QString &value) noexcept;
 
     Q_PROPERTY(bool Terminal READ terminal NOTIFY terminalChanged)
     [[nodiscard]] bool terminal() const noexcept;
@@ -83,10 +88,12 @@ public:
     Q_PROPERTY(bool AutoStart READ isAutoStart WRITE setAutoStart NOTIFY autostartChanged)
     [[nodiscard]] bool isAutoStart() const noexcept;
     void setAutoStart(bool autostart) noexcept;
+    [[nodiscard]] std::optional<QDBusError> writeAutoStart(bool autostart) noexcept;
 
     Q_PROPERTY(QStringList MimeTypes READ mimeTypes WRITE setMimeTypes)
     [[nodiscard]] QStringList mimeTypes() const noexcept;
     void setMimeTypes(const QStringList &value) noexcept;
+    [[nodiscard]] std::optional<QDBusError> writeMimeTypes(const QStringList &value) noexcept;
 
     Q_PROPERTY(QList<QDBusObjectPath> Instances READ instances NOTIFY instanceChanged)
     [[nodiscard]] QList<QDBusObjectPath> instances() const noexcept;
@@ -152,13 +159,25 @@ public:
         return m_Instances;
     }
     void resetEntry(DesktopEntry *newEntry) noexcept;
+    [[nodiscard]] std::shared_ptr<const ApplicationProperties> properties() const noexcept { return m_properties; }
     void detachAllInstance() noexcept;
     [[nodiscard]] QVariant findEntryValue(const QString &group,
                                           const QString &valueKey,
                                           EntryValueType type,
                                           const QLocale &locale = getUserLocale()) const noexcept;
 
+    // Same as getChildInterfacesAndPropertiesFromObject, but the Application interface is filled by the typed getters
+    // instead of reading every adaptor property through the meta-object system.
+    [[nodiscard]] ObjectInterfaceMap interfacesAndProperties() const noexcept;
+    [[nodiscard]] QStringList interfaces() const noexcept;
+    [[nodiscard]] QVariantMap applicationInterfaceProperties() const noexcept;
+    // Name, GenericName and ActionName resolved for locale, cached per locale until the entry changes.
+    [[nodiscard]] QVariantMap localizedProperties(const QLocale &locale) const noexcept;
+
     [[nodiscard]] static std::optional<QStringList> splitExecArguments(QStringView str) noexcept;
+    // Launch without a D-Bus context, error is set to what Launch would reply with.
+    QDBusObjectPath
+    launch(const QString &action, const QStringList &fields, const QVariantMap &options, std::optional<QDBusError> &error);
     bool ensurePropertiesForwarder() noexcept;
 
 public Q_SLOTS:
@@ -168,6 +187,7 @@ public Q_SLOTS:
     [[nodiscard]] ObjectMap GetManagedObjects() const;
     [[nodiscard]] bool SendToDesktop() const noexcept;
     [[nodiscard]] bool RemoveFromDesktop() const noexcept;
+    [[nodiscard]] QVariantMap GetLocalizedProperties(const QString &locale) const noexcept;
 
 Q_SIGNALS:
     void InterfacesAdded(const QDBusObjectPath &object_path, const ObjectInterfaceMap &interfaces);
@@ -217,13 +237,20 @@ private:
     QString m_launcher{getApplicationLauncherBinary()};
     DesktopFile m_desktopSource;
     QSharedPointer<DesktopEntry> m_entry{nullptr};
+    std::shared_ptr<const ApplicationProperties> m_properties{std::make_shared<const ApplicationProperties>()};
+    // keyed by locale name, only valid for the properties of m_localizedVersion.
+    mutable QHash<QString, QVariantMap> m_localizedProperties;
+    mutable quint64 m_localizedVersion{0};
     QHash<QDBusObjectPath, QSharedPointer<InstanceService>> m_Instances;
     QHash<QString, QString> m_pendingLaunchTypes;
     QHash<QString, QString> m_unitResults;
     QSet<QString> m_splashInstanceIds;
     bool m_propertiesForwarderInitialized{false};
+    // resetEntry journals the properties it changes itself.
+    bool m_resettingEntry{false};
     QString m_eventAppId;
     void updateAfterLaunch(bool isLaunch) noexcept;
+    ApplicationProperties::Properties updateProperties() noexcept;
     static bool shouldBeShown(const std::unique_ptr<DesktopEntry> &entry) noexcept;
     [[nodiscard]] bool autostartCheck() const noexcept;
     [[nodiscard]] bool autostartSourceFileExists() const noexcept;
@@ -235,6 +262,8 @@ private:
     void processCompatibility(const QString &action, QVariantMap &options, QString &execStr);
     [[nodiscard]] LaunchTask processExec(const QString &str, const QStringList &fields) const noexcept;
     void closeSplashForInstance(const QString &instanceId) noexcept;
+    void invalidateManagedObject() noexcept;
+    [[nodiscard]] bool isServedByObjectTree() const noexcept;
     void closeAllSplashes() noexcept;
     [[nodiscard]] ApplicationManager1Service *parent() { return dynamic_cast<ApplicationManager1Service *>(QObject::parent()); }
     [[nodiscard]] const ApplicationManager1Service *parent() const
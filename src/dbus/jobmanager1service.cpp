@@ -20,6 +20,53 @@ JobManager1Service::JobManager1Service(ApplicationManager1Service *parent)
 
 JobManager1Service::~JobManager1Service() = default;
 
+QDBusObjectPath JobManager1Service::registerJob(const QString &source, QFuture<QVariantList> future)
+{
+    const auto &objectPath =
+        fromStaticRaw(DDEApplicationManager1JobManager1ObjectPath) % u'/' % QUuid::createUuid().toString(QUuid::Id128);
+    const QSharedPointer<JobService> job{new (std::nothrow) JobService{future}};
+    if (job == nullptr) {
+        qCritical() << "couldn't new JobService.";
+        future.cancel();
+        return {};
+    }
+
+    auto *ptr = job.data();
+    auto *adaptor = new (std::nothrow) JobAdaptor(ptr);
+    if (adaptor == nullptr || !registerObjectToDBus(ptr, objectPath, fromStaticRaw(JobInterface))) {
+        qCritical() << "can't register job to dbus.";
+        future.cancel();
+        return {};
+    }
+
+    auto path = QDBusObjectPath{objectPath};
+    {
+        const QMutexLocker locker{&m_mutex};
+        m_jobs.insert(path, job);  // Insertion is always successful
+    }
+    emit JobNew(path, QDBusObjectPath{source});
+
+    auto emitRemove = [this, job, path, future](QVariantList value) {
+        if (!removeOneJob(path)) {
+            return value;
+        }
+
+        QString result{job->status()};
+        const auto &vals = future.result();
+        for (const auto &val : vals) {
+            if (val.metaType().id() == QMetaType::fromType<QDBusError>().id()) {
+                result = "failed";
+            }
+            break;
+        }
+        emit JobRemoved(path, result, vals);
+        return value;
+    };
+
+    future.then(this, std::move(emitRemove));
+    return path;
+}
+
 bool JobManager1Service::removeOneJob(const QDBusObjectPath &path)
 {
     decltype(m_jobs)::size_type removeCount{0};
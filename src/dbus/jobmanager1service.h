@@ -55,54 +55,37 @@ public:
     {
         static_assert(std::is_invocable_v<F, const QVariant &>, "param type must be satisfied with const QVariant&.");
 
-        const auto &objectPath =
-            fromStaticRaw(DDEApplicationManager1JobManager1ObjectPath) % u'/' % QUuid::createUuid().toString(QUuid::Id128);
         QFuture<QVariantList> future = QtConcurrent::mappedReduced(std::move(args),
                                                                    func,
                                                                    qOverload<QVariantList::parameter_type>(&QVariantList::append),
                                                                    QVariantList{},
                                                                    QtConcurrent::ReduceOption::OrderedReduce);
-        const QSharedPointer<JobService> job{new (std::nothrow) JobService{future}};
-        if (job == nullptr) {
-            qCritical() << "couldn't new JobService.";
-            future.cancel();
-            return {};
-        }
+        return registerJob(source, std::move(future));
+    }
 
-        auto *ptr = job.data();
-        auto *adaptor = new (std::nothrow) JobAdaptor(ptr);
-        if (adaptor == nullptr || !registerObjectToDBus(ptr, objectPath, fromStaticRaw(JobInterface))) {
-            qCritical() << "can't register job to dbus.";
-            future.cancel();
-            return {};
-        }
+    // Like addJob, but func is called for every arg right away in the calling thread and returns a future of its result,
+    // for jobs which wait for something asynchronously instead of occupying a thread of the pool.
+    template <typename F>
+    QDBusObjectPath addAsyncJob(const QString &source, F func, const QVariantList &args)
+    {
+        static_assert(std::is_invocable_r_v<QFuture<QVariant>, F, const QVariant &>,
+                      "func must accept const QVariant& and return QFuture<QVariant>.");
 
-        auto path = QDBusObjectPath{objectPath};
-        {
-            const QMutexLocker locker{&m_mutex};
-            m_jobs.insert(path, job);  // Insertion is always successful
+        QList<QFuture<QVariant>> futures;
+        futures.reserve(args.size());
+        for (const auto &arg : args) {
+            futures.append(func(arg));
         }
-        emit JobNew(path, QDBusObjectPath{source});
-
-        auto emitRemove = [this, job, path, future](QVariantList value) {
-            if (!removeOneJob(path)) {
-                return value;
-            }
 
-            QString result{job->status()};
-            const auto &vals = future.result();
-            for (const auto &val : vals) {
-                if (val.metaType().id() == QMetaType::fromType<QDBusError>().id()) {
-                    result = "failed";
-                }
-                break;
+        auto future = QtFuture::whenAll(futures.cbegin(), futures.cend()).then([](const QList<QFuture<QVariant>> &results) {
+            QVariantList ret;
+            ret.reserve(results.size());
+            for (const auto &result : results) {
+                ret.append(result.isCanceled() ? QVariant{QDBusError::Failed} : result.result());
             }
-            emit JobRemoved(path, result, vals);
-            return value;
-        };
-
-        future.then(this, std::move(emitRemove));
-        return path;
+            return ret;
+        });
+        return registerJob(source, std::move(future));
     }
 
 Q_SIGNALS:
@@ -110,6 +93,7 @@ Q_SIGNALS:
     void JobRemoved(const QDBusObjectPath &job, const QString &status, const QVariantList &result);
 
 private:
+    QDBusObjectPath registerJob(const QString &source, QFuture<QVariantList> future);
     bool removeOneJob(const QDBusObjectPath &path);
     friend class ApplicationManager1Service;
     explicit JobManager1Service(ApplicationManager1Service *parent);
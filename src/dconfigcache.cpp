@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dconfigcache.h"
+#include "constant.h"
+#include "global.h"
+#include <QCoreApplication>
+#include <QLoggingCategory>
+#include <QStringBuilder>
+#include <algorithm>
+#include <tuple>
+
+Q_LOGGING_CATEGORY(logDConfigCache, "dde.am.dconfig")
+
+DCORE_USE_NAMESPACE
+
+DConfigCache::DConfigCache(QObject *parent) noexcept
+    : QObject(parent)
+    , m_create([](const QString &subpath) {
+        return DConfig::create(fromStaticRaw(ApplicationServiceID), fromStaticRaw(ApplicationManagerConfig), subpath);
+    })
+{
+    m_prefetchTimer.setInterval(0);
+    m_prefetchTimer.setSingleShot(true);
+    connect(&m_prefetchTimer, &QTimer::timeout, this, &DConfigCache::prefetchPending);
+
+    // DConfig talks to the config daemon when it's destroyed, don't leave that to static destruction.
+    if (auto *app = QCoreApplication::instance(); app != nullptr) {
+        connect(app, &QCoreApplication::aboutToQuit, this, &DConfigCache::clear);
+    }
+}
+
+DConfigCache &DConfigCache::instance() noexcept
+{
+    static DConfigCache cache;
+    return cache;
+}
+
+DConfigCache::Entry &DConfigCache::entry(const QString &subpath) noexcept
+{
+    auto &entry = m_entries[subpath];
+    // the config daemon may not be up yet, don't remember the failure forever.
+    if (entry.config || !entry.retry.hasExpired()) {
+        return entry;
+    }
+
+    entry.config.reset(m_create(subpath));
+    if (!entry.config || !entry.config->isValid()) {
+        qCDebug(logDConfigCache) << "DConfig of subpath" << subpath << "isn't available.";
+        entry.config.reset();
+        entry.retry.setRemainingTime(RetryInterval);
+        return entry;
+    }
+
+    connect(entry.config.get(), &DConfig::valueChanged, this, [this, subpath](const QString &key) {
+        onValueChanged(subpath, key);
+    });
+    return entry;
+}
+
+DConfig *DConfigCache::config(const QString &subpath) noexcept
+{
+    return entry(subpath).config.get();
+}
+
+QVariant DConfigCache::value(const QString &subpath, const QString &key) noexcept
+{
+    if (auto *config = this->config(subpath); config != nullptr) {
+        return config->value(key);
+    }
+    return {};
+}
+
+const DConfigCache::LaunchEnvironment &DConfigCache::launchEnvironment(const QString &appId) noexcept
+{
+    return launchEnvironment(entry(u'/' % appId));  // $appid as subpath
+}
+
+const DConfigCache::LaunchEnvironment &DConfigCache::launchEnvironment(Entry &entry) noexcept
+{
+    if (entry.launchEnvironment) {
+        return *entry.launchEnvironment;
+    }
+
+    // nothing is remembered for an unavailable config, the next try may succeed.
+    if (!entry.config) {
+        static const LaunchEnvironment empty;
+        return empty;
+    }
+
+    auto &env = entry.launchEnvironment.emplace();
+    env.envs = entry.config->value(fromStaticRaw(AppExtraEnvironments)).toStringList();
+    env.unsetEnvs = entry.config->value(fromStaticRaw(AppEnvironmentsBlacklist)).toStringList();
+    return env;
+}
+
+void DConfigCache::prefetch(const QString &appId) noexcept
+{
+    // a subpath queued twice is a cache hit the second time.
+    m_prefetch.append(u'/' % appId);
+    m_prefetchTimer.start();
+}
+
+void DConfigCache::prefetchPending() noexcept
+{
+    // e.g. every application at startup, don't hold the event loop for all of them at once.
+    const auto count = std::min(m_prefetch.size(), PrefetchBatch);
+    for (const auto &subpath : m_prefetch.first(count)) {
+        std::ignore = launchEnvironment(entry(subpath));
+    }
+
+    m_prefetch.remove(0, count);
+    if (!m_prefetch.isEmpty()) {
+        m_prefetchTimer.start();
+    }
+}
+
+void DConfigCache::remove(const QString &subpath) noexcept
+{
+    m_prefetch.removeAll(subpath);
+    m_entries.erase(subpath);
+}
+
+void DConfigCache::clear() noexcept
+{
+    m_prefetchTimer.stop();
+    m_prefetch.clear();
+    m_entries.clear();
+}
+
+void DConfigCache::onValueChanged(const QString &subpath, const QString &key) noexcept
+{
+    if (auto it = m_entries.find(subpath); it != m_entries.end()) {
+        it->second.launchEnvironment.reset();
+    }
+
+    qCDebug(logDConfigCache) << "value of" << key << "in subpath" << subpath << "changed.";
+    emit valueChanged(subpath, key);
+}
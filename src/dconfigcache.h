@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DCONFIGCACHE_H
+#define DCONFIGCACHE_H
+
+#include <DConfig>
+#include <QDeadlineTimer>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+// Keeps one DConfig of application manager per subpath, "" is the global one and "/$appId" the one of an application.
+// Creating a DConfig reads files or calls the config daemon, so it's done once per subpath instead of once per use.
+// Values derived from a config are dropped as soon as the config reports a change.
+// It lives in the main thread.
+class DConfigCache : public QObject
+{
+    Q_OBJECT
+public:
+    // extra environments of an application and those which must be unset, read from its subpath.
+    struct LaunchEnvironment
+    {
+        QStringList envs;
+        QStringList unsetEnvs;
+    };
+
+    ~DConfigCache() override = default;
+    DConfigCache(const DConfigCache &) = delete;
+    DConfigCache(DConfigCache &&) = delete;
+    DConfigCache &operator=(const DConfigCache &) = delete;
+    DConfigCache &operator=(DConfigCache &&) = delete;
+
+    static DConfigCache &instance() noexcept;
+
+    // nullptr if the config isn't available, it's created again at most once per RetryInterval.
+    [[nodiscard]] Dtk::Core::DConfig *config(const QString &subpath) noexcept;
+    // an invalid QVariant if the config isn't available.
+    [[nodiscard]] QVariant value(const QString &subpath, const QString &key) noexcept;
+    [[nodiscard]] const LaunchEnvironment &launchEnvironment(const QString &appId) noexcept;
+    // reads the launch environment of appId in a later turn of the event loop, so the first Launch finds it cached.
+    void prefetch(const QString &appId) noexcept;
+
+    // drops the handle of a subpath, e.g. its application is removed.
+    void remove(const QString &subpath) noexcept;
+    void clear() noexcept;
+
+Q_SIGNALS:
+    void valueChanged(const QString &subpath, const QString &key);
+
+private:
+    explicit DConfigCache(QObject *parent = nullptr) noexcept;
+
+    struct Entry
+    {
+        std::unique_ptr<Dtk::Core::DConfig> config;
+        std::optional<LaunchEnvironment> launchEnvironment;
+        // when an unavailable config may be created again.
+        QDeadlineTimer retry;
+    };
+
+    static constexpr std::chrono::seconds RetryInterval{5};
+    // subpaths prefetched per turn of the event loop, creating a config may call the config daemon.
+    static constexpr qsizetype PrefetchBatch = 16;
+
+    Entry &entry(const QString &subpath) noexcept;
+    const LaunchEnvironment &launchEnvironment(Entry &entry) noexcept;
+    void prefetchPending() noexcept;
+    void onValueChanged(const QString &subpath, const QString &key) noexcept;
+
+    std::unordered_map<QString, Entry> m_entries;
+    std::function<Dtk::Core::DConfig *(const QString &subpath)> m_create;
+    QStringList m_prefetch;
+    QTimer m_prefetchTimer;
+};
+
+#endif
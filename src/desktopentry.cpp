@@ -5,6 +5,8 @@
 #include "global.h"
 #include "desktopentry.h"
 #include "desktopfileparser.h"
+#include "desktopidindex.h"
+#include "textkernels.h"
 #include <QDir>
 #include <QDirIterator>
 #include <QLoggingCategory>
@@ -70,8 +72,86 @@ namespace {
     auto toMSecs = [](const struct timespec &ts) -> qint64 { return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000; };
     return std::pair{toMSecs(st.st_mtim), toMSecs(st.st_ctim)};
 }
+
+[[nodiscard]] QVariant normalizedValue(const DesktopEntry::Value &value) noexcept
+{
+    const auto id = value.userType();
+    if (id == QMetaType::fromType<EncodedValue>().id()) {
+        return static_cast<const EncodedValue *>(value.constData())->decoded();
+    }
+
+    if (id == QMetaType::fromType<EncodedLocaleMap>().id()) {
+        return QVariant::fromValue(value.value<QStringMap>());
+    }
+
+    return value;
+}
+
+[[nodiscard]] bool sameContent(const DesktopEntry::container_type &lhs, const DesktopEntry::container_type &rhs) noexcept
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    for (auto lGroup = lhs.cbegin(), rGroup = rhs.cbegin(); lGroup != lhs.cend(); ++lGroup, ++rGroup) {
+        if (lGroup.key() != rGroup.key() || lGroup->size() != rGroup->size()) {
+            return false;
+        }
+
+        for (auto lIt = lGroup->cbegin(), rIt = rGroup->cbegin(); lIt != lGroup->cend(); ++lIt, ++rIt) {
+            if (lIt.key() != rIt.key()) {
+                return false;
+            }
+
+            if (lIt->userType() == rIt->userType()) {
+                if (*lIt != *rIt) {
+                    return false;
+                }
+                continue;
+            }
+
+            // entries loaded from different sources may hold encoded and decoded values of the same content.
+            if (normalizedValue(*lIt) != normalizedValue(*rIt)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
 }  // namespace
 
+void registerEncodedValueConverters() noexcept
+{
+    // keep QVariant::toString() and value<QStringMap>() working for lazily decoded entries.
+    static const bool registered = [] {
+        QMetaType::registerConverter<EncodedValue, QString>([](const EncodedValue &value) { return value.decoded(); });
+        QMetaType::registerConverter<EncodedLocaleMap, QStringMap>([](const EncodedLocaleMap &map) {
+            QStringMap ret;
+            for (auto it = map.cbegin(); it != map.cend(); ++it) {
+                ret.insert(ret.cend(), it.key(), it->decoded());
+            }
+            return ret;
+        });
+        return true;
+    }();
+    Q_UNUSED(registered)
+}
+
+QString EncodedValue::decoded() const noexcept
+{
+    if (m_decoded) {
+        return *m_decoded;
+    }
+
+    auto str = QString::fromUtf8(bytes());
+    if (m_memoize) {
+        m_decoded = str;
+    }
+
+    return str;
+}
+
 bool DesktopEntry::checkMainEntryValidation() const noexcept
 {
     auto it = m_entryMap.constFind(fromStaticRaw(DesktopFileEntryKey));
@@ -237,6 +317,20 @@ std::optional<DesktopFile> DesktopFile::searchDesktopFileByPath(const QString &d
 
 std::optional<DesktopFile> DesktopFile::searchDesktopFileById(QStringView appId, ParserError &err) noexcept
 {
+    if (const auto &index = DesktopIdIndex::instance(); index.isPopulated()) {
+        const auto id = appId.toString();
+        const auto path = index.path(id);
+        if (!path.isEmpty()) {
+            if (auto ret = createDesktopFile(QFileInfo{path}, id); ret) {
+                err = ParserError::NoError;
+                return ret;
+            }
+        }
+
+        err = ParserError::NotFound;
+        return std::nullopt;
+    }
+
     auto appDirs = getApplicationsDirs();
 
     for (const auto &dir : std::as_const(appDirs)) {
@@ -267,7 +361,7 @@ bool DesktopFile::modified(qint64 time) const noexcept
     return time != m_mtime;
 }
 
-ParserError DesktopEntry::parse(const DesktopFile &file) noexcept
+ParserError DesktopEntry::parse(const DesktopFile &file, ValueDecoding decoding) noexcept
 {
     DesktopFileGuard guard{file};
 
@@ -276,10 +370,10 @@ ParserError DesktopEntry::parse(const DesktopFile &file) noexcept
         return ParserError::OpenFailed;
     }
 
-    return parse(file.sourceFileRef());
+    return parse(file.sourceFileRef(), decoding);
 }
 
-ParserError DesktopEntry::parse(QFile &file) noexcept
+ParserError DesktopEntry::parse(QFile &file, ValueDecoding decoding) noexcept
 {
     if (m_parsed) {
         return ParserError::Parsed;
@@ -289,9 +383,14 @@ ParserError DesktopEntry::parse(QFile &file) noexcept
         return ParserError::OpenFailed;
     }
 
+    if (decoding != ValueDecoding::Eager) {
+        registerEncodedValueConverters();
+    }
+
     ParserError err{ParserError::NoError};
-    DesktopFileParser p(file);
+    DesktopFileParser p(file, decoding);
     err = p.parse(m_entryMap);
+    m_contentHash = p.contentHash();
     m_parsed = true;
     if (err != ParserError::NoError) {
         return err;
@@ -337,45 +436,59 @@ void DesktopEntry::insert(const QString &key, const QString &valueKey, Value &&v
 {
     auto &outer = m_entryMap[key];  // NOLINT
     outer.insert(valueKey, val);
+    m_contentHash = 0;
 }
 
 QString unescapeValue(QStringView str) noexcept
 {
+    auto backslash = TextKernels::indexOf(str, u'\\');
+    if (backslash == -1) {
+        return str.toString();
+    }
+
     QString out;
     out.reserve(str.size());
 
-    for (const auto *it = str.begin(); it != str.end(); ++it) {
-        if (*it == u'\\' && (it + 1) != str.end()) {
-            const auto next = (*(++it)).unicode();
-            switch (next) {
-            case 's':
-                out.append(u' ');
-                break;
-            case 'n':
-                out.append(u'\n');
-                break;
-            case 't':
-                out.append(u'\t');
-                break;
-            case 'r':
-                out.append(u'\r');
-                break;
-            case '\\':
-                out.append(u'\\');
-                break;
-            case ';':
-                out.append(u';');
-                break;
-            default:
-                out.append(u'\\');
-                out.append(next);
-                break;
-            }
-        } else {
-            out.append(*it);
+    qsizetype begin{0};
+    while (backslash != -1) {
+        // copy everything before the escape sequence at once.
+        out.append(str.sliced(begin, backslash - begin));
+        if (backslash + 1 == str.size()) {
+            out.append(u'\\');
+            return out;
         }
+
+        const auto next = str.at(backslash + 1).unicode();
+        switch (next) {
+        case 's':
+            out.append(u' ');
+            break;
+        case 'n':
+            out.append(u'\n');
+            break;
+        case 't':
+            out.append(u'\t');
+            break;
+        case 'r':
+            out.append(u'\r');
+            break;
+        case '\\':
+            out.append(u'\\');
+            break;
+        case ';':
+            out.append(u';');
+            break;
+        default:
+            out.append(u'\\');
+            out.append(QChar{next});
+            break;
+        }
+
+        begin = backslash + 2;
+        backslash = TextKernels::indexOf(str, u'\\', begin);
     }
 
+    out.append(str.sliced(begin));
     return out;
 }
 
@@ -392,6 +505,14 @@ QString toString(const DesktopEntry::Value &value, bool skipUnescape) noexcept
         }
     } else if (id == QMetaType::QString) {
         str = *static_cast<const QString *>(value.constData());
+    } else if (id == QMetaType::fromType<EncodedLocaleMap>().id()) {
+        const auto &val = *static_cast<const EncodedLocaleMap *>(value.constData());
+        auto it = val.constFind(fromStaticRaw(DesktopFileDefaultKeyLocale));
+        if (it != val.cend()) {
+            str = it->decoded();
+        }
+    } else if (id == QMetaType::fromType<EncodedValue>().id()) {
+        str = static_cast<const EncodedValue *>(value.constData())->decoded();
     } else {
         qCritical() << "unknown value type:" << id;
         return {};
@@ -402,7 +523,8 @@ QString toString(const DesktopEntry::Value &value, bool skipUnescape) noexcept
         return str;
     }
 
-    if (!skipUnescape) {
+    // the value is kept as is when it has nothing to unescape.
+    if (!skipUnescape && TextKernels::indexOf(str, u'\\') != -1) {
         str = unescapeValue(str);
     }
 
@@ -416,12 +538,18 @@ QString toString(const DesktopEntry::Value &value, bool skipUnescape) noexcept
 QString toLocaleString(const DesktopEntry::Value &localeEntry, const QLocale &locale) noexcept
 {
     // see: https://specifications.freedesktop.org/desktop-entry/latest/localized-keys.html
-    if (localeEntry.userType() != QMetaTypeId<QStringMap>::qt_metatype_id()) {
+    const auto id = localeEntry.userType();
+    const QStringMap *localeMap{nullptr};
+    const EncodedLocaleMap *encodedMap{nullptr};
+    if (id == QMetaTypeId<QStringMap>::qt_metatype_id()) {
+        localeMap = static_cast<const QStringMap *>(localeEntry.constData());
+    } else if (id == QMetaType::fromType<EncodedLocaleMap>().id()) {
+        encodedMap = static_cast<const EncodedLocaleMap *>(localeEntry.constData());
+    } else {
         return {};
     }
 
-    const auto &localeMap = *static_cast<const QStringMap *>(localeEntry.constData());
-    if (Q_UNLIKELY(localeMap.isEmpty())) {
+    if (Q_UNLIKELY(localeMap != nullptr ? localeMap->isEmpty() : encodedMap->isEmpty())) {
         return {};
     }
 
@@ -467,10 +595,14 @@ QString toLocaleString(const DesktopEntry::Value &localeEntry, const QLocale &lo
     // lang
     candidates.append(lang.toString());
 
+    // only the matched translation is decoded for lazily parsed entries.
     for (const auto &key : candidates) {
-        auto it = localeMap.constFind(key);
-        if (it != localeMap.cend()) {
-            return unescapeValue(it.value());
+        if (localeMap != nullptr) {
+            if (auto it = localeMap->constFind(key); it != localeMap->cend()) {
+                return unescapeValue(it.value());
+            }
+        } else if (auto it = encodedMap->constFind(key); it != encodedMap->cend()) {
+            return unescapeValue(it->decoded());
         }
     }
 
@@ -501,16 +633,53 @@ bool toBoolean(const DesktopEntry::Value &value, bool &ok) noexcept
 
 float toNumeric(const DesktopEntry::Value &value, bool &ok) noexcept
 {
+    if (value.userType() == QMetaType::fromType<EncodedValue>().id()) {
+        return static_cast<const EncodedValue *>(value.constData())->decoded().toFloat(&ok);
+    }
+
     return value.toFloat(&ok);
 }
 
+QVariant toTypedValue(const DesktopEntry::Value &value, EntryValueType type, const QLocale &locale) noexcept
+{
+    switch (type) {
+    case EntryValueType::Raw: {
+        auto valStr = toString(value, true);
+        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
+    }
+    case EntryValueType::String: {
+        auto valStr = toString(value);
+        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
+    }
+    case EntryValueType::LocaleString: {
+        auto valStr = toLocaleString(value, locale);
+        if (valStr.isEmpty()) {
+            valStr = toString(value);
+        }
+
+        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
+    }
+    case EntryValueType::Boolean: {
+        bool ok{false};
+        auto valBool = toBoolean(value, ok);
+        return ok ? valBool : QVariant{};
+    }
+    case EntryValueType::IconString: {
+        auto valStr = toIconString(value);
+        return valStr.isEmpty() ? QVariant{} : QVariant::fromValue(std::move(valStr));
+    }
+    }
+
+    Q_UNREACHABLE();
+}
+
 bool operator==(const DesktopEntry &lhs, const DesktopEntry &rhs)
 {
     if (lhs.m_parsed != rhs.m_parsed) {
         return false;
     }
 
-    if (lhs.m_entryMap != rhs.m_entryMap) {
+    if (lhs.m_entryMap != rhs.m_entryMap && !sameContent(lhs.m_entryMap, rhs.m_entryMap)) {
         return false;
     }
 
@@ -17,6 +17,49 @@ enum class EntryContext : uint8_t { Unknown, EntryOuter, Entry, Done };
 
 enum class EntryValueType : uint8_t { String, LocaleString, Boolean, IconString, Raw };
 
+// Eager decodes every value to UTF-16 while parsing.
+// Lazy keeps values as EncodedValue slices of the file content and decodes them on demand,
+// LazyMemoized additionally keeps the decoded string of every value which has been requested.
+enum class ValueDecoding : uint8_t { Eager, Lazy, LazyMemoized };
+
+class EncodedValue
+{
+public:
+    EncodedValue() = default;
+    EncodedValue(std::shared_ptr<const FileContent> source, qsizetype offset, qsizetype size, bool memoize) noexcept
+        : m_source(std::move(source))
+        , m_offset(offset)
+        , m_size(size)
+        , m_memoize(memoize)
+    {
+    }
+
+    [[nodiscard]] QByteArrayView bytes() const noexcept
+    {
+        return m_source ? m_source->view().sliced(m_offset, m_size) : QByteArrayView{};
+    }
+    [[nodiscard]] QString decoded() const noexcept;
+
+    friend bool operator==(const EncodedValue &lhs, const EncodedValue &rhs) noexcept { return lhs.bytes() == rhs.bytes(); }
+    friend bool operator!=(const EncodedValue &lhs, const EncodedValue &rhs) noexcept { return !(lhs == rhs); }
+
+private:
+    std::shared_ptr<const FileContent> m_source{nullptr};
+    qsizetype m_offset{0};
+    qsizetype m_size{0};
+    bool m_memoize{false};
+    // NOTE: not synchronized, an entry should only be read by the thread which owns it.
+    mutable std::optional<QString> m_decoded;
+};
+
+using EncodedLocaleMap = QMap<QString, EncodedValue>;
+
+Q_DECLARE_METATYPE(EncodedValue)
+Q_DECLARE_METATYPE(EncodedLocaleMap)
+
+// Registers QVariant conversions of EncodedValue/EncodedLocaleMap to QString/QStringMap, it's idempotent.
+void registerEncodedValueConverters() noexcept;
+
 struct DesktopFileGuard;
 
 struct DesktopFile
@@ -36,10 +79,12 @@ struct DesktopFile
     [[nodiscard]] bool hasStandardizedApplicationFileName() const noexcept;
     [[nodiscard]] bool modified(qint64 time) const noexcept;
     [[nodiscard]] qint64 createTime() const noexcept { return m_ctime; }
+    [[nodiscard]] qint64 modifiedTime() const noexcept { return m_mtime; }
 
     friend bool operator==(const DesktopFile &lhs, const DesktopFile &rhs);
     friend bool operator!=(const DesktopFile &lhs, const DesktopFile &rhs);
 
+    // answered by DesktopIdIndex once it's populated, otherwise every applications directory is probed.
     static std::optional<DesktopFile> searchDesktopFileById(QStringView appId, ParserError &err) noexcept;
     static std::optional<DesktopFile> searchDesktopFileByPath(const QString &desktopFile, ParserError &err) noexcept;
     static std::optional<DesktopFile> createDesktopFile(const QFileInfo &desktopFileInfo, QString desktopId) noexcept;
@@ -128,22 +173,26 @@ public:
     DesktopEntry &operator=(DesktopEntry &&) = default;
 
     ~DesktopEntry() = default;
-    [[nodiscard]] ParserError parse(const DesktopFile &file) noexcept;
-    [[nodiscard]] ParserError parse(QFile &file) noexcept;
+    [[nodiscard]] ParserError parse(const DesktopFile &file, ValueDecoding decoding = ValueDecoding::Eager) noexcept;
+    [[nodiscard]] ParserError parse(QFile &file, ValueDecoding decoding = ValueDecoding::Eager) noexcept;
     [[nodiscard]] std::optional<std::reference_wrapper<const QMap<QString, DesktopEntry::Value>>>
     group(const QString &key) const noexcept;
     [[nodiscard]] std::optional<std::reference_wrapper<const Value>> value(const QString &key,
                                                                            const QString &valueKey) const noexcept;
     void insert(const QString &key, const QString &valueKey, Value &&val) noexcept;
     [[nodiscard]] const auto &data() const noexcept { return m_entryMap; }
+    // hash of the parsed file content, 0 if unknown, e.g. the entry was modified after parsing.
+    [[nodiscard]] std::size_t contentHash() const noexcept { return m_contentHash; }
 
     friend bool operator==(const DesktopEntry &lhs, const DesktopEntry &rhs);
     friend bool operator!=(const DesktopEntry &lhs, const DesktopEntry &rhs);
 
 private:
+    friend class DesktopEntryCache;
     [[nodiscard]] bool checkMainEntryValidation() const noexcept;
     QMap<QString, QMap<QString, Value>> m_entryMap;
     bool m_parsed{false};
+    std::size_t m_contentHash{0};
 
 public:
     using container_type = decltype(m_entryMap);
@@ -169,4 +218,7 @@ QString toIconString(const DesktopEntry::Value &value) noexcept;
 
 float toNumeric(const DesktopEntry::Value &value, bool &ok) noexcept;
 
+// converts value the way type describes, returns a null QVariant if it's empty or can't be converted.
+QVariant toTypedValue(const DesktopEntry::Value &value, EntryValueType type, const QLocale &locale) noexcept;
+
 #endif
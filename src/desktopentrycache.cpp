@@ -0,0 +1,399 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopentrycache.h"
+#include "global.h"
+#include "stringinterner.h"
+#include <QBuffer>
+#include <QDataStream>
+#include <QDir>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <QStringBuilder>
+
+using namespace Qt::StringLiterals;
+
+Q_LOGGING_CATEGORY(logDesktopEntryCache, "dde.am.desktopfile.cache")
+
+namespace {
+constexpr quint32 CacheMagic = 0x44414543;  // "DAEC"
+constexpr quint32 CacheFormatVersion = 4;
+constexpr auto CacheStreamVersion = QDataStream::Qt_6_0;
+
+enum class ValueTag : quint8 { String, LocaleString };
+
+void writeUtf8(QDataStream &stream, QByteArrayView bytes) noexcept
+{
+    stream << static_cast<quint32>(bytes.size());
+    stream.writeRawData(bytes.data(), static_cast<int>(bytes.size()));
+}
+
+// values are stored as UTF-8 so lazily decoded entries can be restored without decoding them.
+[[nodiscard]] QByteArray serializeEntry(const DesktopEntry &entry) noexcept
+{
+    QByteArray payload;
+    QDataStream stream{&payload, QIODevice::WriteOnly};
+    stream.setVersion(CacheStreamVersion);
+
+    const auto &groups = entry.data();
+    stream << static_cast<quint64>(entry.contentHash()) << static_cast<quint32>(groups.size());
+    for (auto group = groups.cbegin(); group != groups.cend(); ++group) {
+        stream << group.key() << static_cast<quint32>(group->size());
+        for (auto it = group->cbegin(); it != group->cend(); ++it) {
+            stream << it.key();
+            const auto typeId = it->userType();
+            if (typeId == QMetaType::QString) {
+                stream << static_cast<quint8>(ValueTag::String);
+                writeUtf8(stream, static_cast<const QString *>(it->constData())->toUtf8());
+            } else if (typeId == QMetaType::fromType<EncodedValue>().id()) {
+                stream << static_cast<quint8>(ValueTag::String);
+                writeUtf8(stream, static_cast<const EncodedValue *>(it->constData())->bytes());
+            } else if (typeId == QMetaTypeId<QStringMap>::qt_metatype_id()) {
+                const auto &localeMap = *static_cast<const QStringMap *>(it->constData());
+                stream << static_cast<quint8>(ValueTag::LocaleString) << static_cast<quint32>(localeMap.size());
+                for (auto locale = localeMap.cbegin(); locale != localeMap.cend(); ++locale) {
+                    stream << locale.key();
+                    writeUtf8(stream, locale->toUtf8());
+                }
+            } else if (typeId == QMetaType::fromType<EncodedLocaleMap>().id()) {
+                const auto &localeMap = *static_cast<const EncodedLocaleMap *>(it->constData());
+                stream << static_cast<quint8>(ValueTag::LocaleString) << static_cast<quint32>(localeMap.size());
+                for (auto locale = localeMap.cbegin(); locale != localeMap.cend(); ++locale) {
+                    stream << locale.key();
+                    writeUtf8(stream, locale->bytes());
+                }
+            } else {
+                qCDebug(logDesktopEntryCache) << "unsupported value type" << typeId << "of" << it.key() << ", skip caching.";
+                return {};
+            }
+        }
+    }
+
+    return payload;
+}
+
+// NOTE: encoded values share payload, it must own its data when decoding isn't eager.
+[[nodiscard]] bool deserializeEntry(const QByteArray &payload,
+                                    ValueDecoding decoding,
+                                    DesktopEntry::container_type &groups,
+                                    std::size_t &contentHash) noexcept
+{
+    QDataStream stream{payload};
+    stream.setVersion(CacheStreamVersion);
+
+    quint64 hash{0};
+    stream >> hash;
+    contentHash = static_cast<std::size_t>(hash);
+
+    auto &interner = StringInterner::instance();
+    const bool memoize = decoding == ValueDecoding::LazyMemoized;
+
+    const auto backing = decoding == ValueDecoding::Eager ? nullptr : FileContent::fromByteArray(payload);
+    auto readValue = [&stream, &payload, &backing, memoize](auto &value) -> bool {
+        quint32 size{0};
+        stream >> size;
+        const auto offset = stream.device()->pos();
+        if (stream.status() != QDataStream::Ok || stream.skipRawData(static_cast<int>(size)) != static_cast<int>(size)) {
+            return false;
+        }
+
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, QString>) {
+            value = QString::fromUtf8(QByteArrayView{payload}.sliced(offset, size));
+        } else {
+            value = EncodedValue{backing, offset, size, memoize};
+        }
+        return true;
+    };
+
+    auto readEntry = [&](auto valueTag) -> bool {
+        using ValueType = decltype(valueTag);
+        using MapType = QMap<QString, ValueType>;
+
+        // records are written in map order, so every insertion below is appended at the end.
+        quint32 groupCount{0};
+        stream >> groupCount;
+        for (quint32 i = 0; i < groupCount && stream.status() == QDataStream::Ok; ++i) {
+            QString groupName;
+            quint32 keyCount{0};
+            stream >> groupName >> keyCount;
+
+            auto group = groups.insert(groups.cend(), interner.intern(groupName), {});
+            for (quint32 j = 0; j < keyCount && stream.status() == QDataStream::Ok; ++j) {
+                QString key;
+                quint8 tag{0};
+                stream >> key >> tag;
+
+                switch (static_cast<ValueTag>(tag)) {
+                case ValueTag::String: {
+                    ValueType value;
+                    if (!readValue(value)) {
+                        return false;
+                    }
+                    group->insert(group->cend(), interner.intern(key), QVariant::fromValue(std::move(value)));
+                } break;
+                case ValueTag::LocaleString: {
+                    quint32 localeCount{0};
+                    stream >> localeCount;
+
+                    MapType value;
+                    for (quint32 k = 0; k < localeCount && stream.status() == QDataStream::Ok; ++k) {
+                        QString locale;
+                        ValueType localeValue;
+                        stream >> locale;
+                        if (!readValue(localeValue)) {
+                            return false;
+                        }
+                        value.insert(value.cend(), interner.intern(locale), std::move(localeValue));
+                    }
+                    group->insert(group->cend(), interner.intern(key), QVariant::fromValue(std::move(value)));
+                } break;
+                default:
+                    return false;
+                }
+            }
+        }
+
+        return stream.status() == QDataStream::Ok;
+    };
+
+    return decoding == ValueDecoding::Eager ? readEntry(QString{}) : readEntry(EncodedValue{});
+}
+}  // namespace
+
+DesktopEntryCache::DesktopEntryCache(QString cacheFile) noexcept
+    : m_cacheFile(std::move(cacheFile))
+{
+}
+
+DesktopEntryCache::~DesktopEntryCache()
+{
+    unmap();
+}
+
+QString DesktopEntryCache::defaultCacheFile() noexcept
+{
+    return getXDGCacheHome() % fromStaticRaw(ApplicationManagerCacheDir) % u'/' % fromStaticRaw(DesktopEntryCacheFile);
+}
+
+void DesktopEntryCache::unmap() noexcept
+{
+    if (m_data != nullptr) {
+        m_file.unmap(const_cast<uchar *>(m_data));  // NOLINT
+        m_data = nullptr;
+    }
+
+    m_dataSize = 0;
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+
+    m_records.clear();
+    m_used.clear();
+}
+
+bool DesktopEntryCache::load() noexcept
+{
+    unmap();
+    m_pending.clear();
+
+    m_file.setFileName(m_cacheFile);
+    if (!m_file.exists()) {
+        return false;
+    }
+
+    if (!m_file.open(QFile::ReadOnly)) {
+        qCWarning(logDesktopEntryCache) << "open cache file" << m_cacheFile << "failed:" << m_file.errorString();
+        return false;
+    }
+
+    const auto fileSize = m_file.size();
+    if (fileSize <= 0) {
+        m_file.close();
+        return false;
+    }
+
+    m_data = m_file.map(0, fileSize);
+    if (m_data == nullptr) {
+        qCWarning(logDesktopEntryCache) << "map cache file" << m_cacheFile << "failed:" << m_file.errorString();
+        m_file.close();
+        return false;
+    }
+    m_dataSize = fileSize;
+
+    // only the record headers are read here, payloads stay in the mapping until they're looked up.
+    const auto raw = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data), m_dataSize);  // NOLINT
+    QBuffer buffer;
+    buffer.setData(raw);
+    if (!buffer.open(QIODevice::ReadOnly)) {
+        unmap();
+        return false;
+    }
+
+    QDataStream stream{&buffer};
+    stream.setVersion(CacheStreamVersion);
+
+    quint32 magic{0};
+    quint32 version{0};
+    quint32 count{0};
+    stream >> magic >> version >> count;
+    if (stream.status() != QDataStream::Ok || magic != CacheMagic || version != CacheFormatVersion) {
+        qCInfo(logDesktopEntryCache) << "cache file" << m_cacheFile << "is outdated or broken, ignore it.";
+        unmap();
+        return false;
+    }
+
+    m_records.reserve(count);
+    for (quint32 i = 0; i < count; ++i) {
+        QString path;
+        Record record;
+        quint32 size{0};
+        stream >> path >> record.mtime >> record.ctime >> size;
+        if (stream.status() != QDataStream::Ok || size == 0xFFFFFFFF) {
+            break;
+        }
+
+        record.offset = buffer.pos();
+        record.size = size;
+        if (stream.skipRawData(static_cast<int>(size)) != static_cast<int>(size)) {
+            stream.setStatus(QDataStream::ReadCorruptData);
+            break;
+        }
+
+        m_records.insert(path, record);
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        qCWarning(logDesktopEntryCache) << "cache file" << m_cacheFile << "is corrupted, ignore it.";
+        unmap();
+        return false;
+    }
+
+    qCDebug(logDesktopEntryCache) << "load" << m_records.size() << "entries from" << m_cacheFile;
+    return true;
+}
+
+std::unique_ptr<DesktopEntry> DesktopEntryCache::find(const DesktopFile &file, ValueDecoding decoding) noexcept
+{
+    const auto &path = file.sourcePath();
+    QByteArray payload;
+
+    if (auto pending = m_pending.constFind(path); pending != m_pending.cend()) {
+        if (pending->mtime != file.modifiedTime() || pending->ctime != file.createTime()) {
+            return nullptr;
+        }
+        payload = pending->payload;
+    } else if (auto record = m_records.constFind(path); record != m_records.cend()) {
+        if (record->mtime != file.modifiedTime() || record->ctime != file.createTime()) {
+            return nullptr;
+        }
+        // the mapping is replaced on every save, encoded values need their own copy of the record.
+        const auto *recordData = reinterpret_cast<const char *>(m_data + record->offset);  // NOLINT
+        const auto recordSize = static_cast<qsizetype>(record->size);
+        payload = decoding == ValueDecoding::Eager ? QByteArray::fromRawData(recordData, recordSize)
+                                                   : QByteArray{recordData, recordSize};
+    } else {
+        return nullptr;
+    }
+
+    if (decoding != ValueDecoding::Eager) {
+        registerEncodedValueConverters();
+    }
+
+    auto entry = std::make_unique<DesktopEntry>();
+    if (!deserializeEntry(payload, decoding, entry->m_entryMap, entry->m_contentHash)) {
+        qCWarning(logDesktopEntryCache) << "broken cache record of" << path << ", reparse it.";
+        return nullptr;
+    }
+    entry->m_parsed = true;
+
+    if (m_records.contains(path)) {
+        m_used.insert(path);
+    }
+
+    return entry;
+}
+
+void DesktopEntryCache::insert(const DesktopFile &file, const DesktopEntry &entry) noexcept
+{
+    auto payload = serializeEntry(entry);
+    if (payload.isEmpty()) {
+        return;
+    }
+
+    m_pending.insert(file.sourcePath(), PendingRecord{file.modifiedTime(), file.createTime(), std::move(payload)});
+}
+
+bool DesktopEntryCache::touch(const DesktopFile &file) noexcept
+{
+    const auto &path = file.sourcePath();
+    if (auto pending = m_pending.constFind(path); pending != m_pending.cend()) {
+        return pending->mtime == file.modifiedTime() && pending->ctime == file.createTime();
+    }
+
+    auto record = m_records.constFind(path);
+    if (record == m_records.cend() || record->mtime != file.modifiedTime() || record->ctime != file.createTime()) {
+        return false;
+    }
+
+    m_used.insert(path);
+    return true;
+}
+
+bool DesktopEntryCache::isDirty(Retention retention) const noexcept
+{
+    return !m_pending.isEmpty() || (retention == Retention::UsedOnly && m_used.size() != m_records.size());
+}
+
+bool DesktopEntryCache::save(Retention retention) noexcept
+{
+    if (!isDirty(retention)) {
+        return true;
+    }
+
+    const auto dir = QFileInfo{m_cacheFile}.absoluteDir();
+    if (!dir.exists() && !dir.mkpath(u"."_s)) {
+        qCWarning(logDesktopEntryCache) << "couldn't create cache directory" << dir.absolutePath();
+        return false;
+    }
+
+    QSaveFile out{m_cacheFile};
+    if (!out.open(QIODevice::WriteOnly)) {
+        qCWarning(logDesktopEntryCache) << "open cache file" << m_cacheFile << "failed:" << out.errorString();
+        return false;
+    }
+
+    QDataStream stream{&out};
+    stream.setVersion(CacheStreamVersion);
+
+    // with UsedOnly, stale records (deleted or changed files) are dropped by only keeping the ones used since last load.
+    QStringList kept;
+    if (retention == Retention::UsedOnly) {
+        kept = QStringList{m_used.cbegin(), m_used.cend()};
+    } else {
+        kept = m_records.keys();
+    }
+    kept.removeIf([this](const QString &path) { return m_pending.contains(path); });
+
+    const auto count = static_cast<quint32>(m_pending.size() + kept.size());
+
+    stream << CacheMagic << CacheFormatVersion << count;
+    for (auto it = m_pending.cbegin(); it != m_pending.cend(); ++it) {
+        stream << it.key() << it->mtime << it->ctime << it->payload;
+    }
+
+    for (const auto &path : std::as_const(kept)) {
+        const auto &record = m_records[path];
+        const auto payload = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data + record.offset),  // NOLINT
+                                                     static_cast<qsizetype>(record.size));
+        stream << path << record.mtime << record.ctime << payload;
+    }
+
+    if (stream.status() != QDataStream::Ok || !out.commit()) {
+        qCWarning(logDesktopEntryCache) << "write cache file" << m_cacheFile << "failed:" << out.errorString();
+        return false;
+    }
+
+    qCDebug(logDesktopEntryCache) << "save" << count << "entries to" << m_cacheFile;
+    return load();
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DESKTOPENTRYCACHE_H
+#define DESKTOPENTRYCACHE_H
+
+#include "desktopentry.h"
+#include <QFile>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <memory>
+
+// On-disk cache of parsed desktop entries.
+// Records are keyed by the absolute source path and validated against the mtime/ctime
+// recorded by DesktopFile, so only files whose stat signature changed need to be parsed again.
+// The cache file is memory-mapped and a record is only deserialized when it's looked up.
+class DesktopEntryCache
+{
+public:
+    explicit DesktopEntryCache(QString cacheFile) noexcept;
+    ~DesktopEntryCache();
+    DesktopEntryCache(const DesktopEntryCache &) = delete;
+    DesktopEntryCache(DesktopEntryCache &&) = delete;
+    DesktopEntryCache &operator=(const DesktopEntryCache &) = delete;
+    DesktopEntryCache &operator=(DesktopEntryCache &&) = delete;
+
+    // UsedOnly drops every record which hasn't been looked up since the last load, it fits a full rescan.
+    // All keeps them, it fits updating a few changed files.
+    enum class Retention : uint8_t { UsedOnly, All };
+
+    bool load() noexcept;
+    bool save(Retention retention = Retention::UsedOnly) noexcept;
+
+    [[nodiscard]] std::unique_ptr<DesktopEntry> find(const DesktopFile &file,
+                                                     ValueDecoding decoding = ValueDecoding::Eager) noexcept;
+    void insert(const DesktopFile &file, const DesktopEntry &entry) noexcept;
+    // Keeps the record of an unchanged file without deserializing it, returns false if there's no valid record.
+    bool touch(const DesktopFile &file) noexcept;
+
+    [[nodiscard]] bool isDirty(Retention retention = Retention::UsedOnly) const noexcept;
+    [[nodiscard]] qsizetype size() const noexcept { return m_records.size(); }
+    [[nodiscard]] const QString &cacheFile() const noexcept { return m_cacheFile; }
+
+    [[nodiscard]] static QString defaultCacheFile() noexcept;
+
+private:
+    struct Record
+    {
+        qint64 mtime{0};
+        qint64 ctime{0};
+        qint64 offset{0};
+        qint64 size{0};
+    };
+
+    struct PendingRecord
+    {
+        qint64 mtime{0};
+        qint64 ctime{0};
+        QByteArray payload;
+    };
+
+    void unmap() noexcept;
+
+    QString m_cacheFile;
+    QFile m_file;
+    const uchar *m_data{nullptr};
+    qint64 m_dataSize{0};
+    QHash<QString, Record> m_records;
+    QHash<QString, PendingRecord> m_pending;
+    QSet<QString> m_used;
+};
+
+#endif
@@ -9,6 +9,8 @@
 #include "desktopfileparser.h"
 #include "constant.h"
 #include "global.h"
+#include "stringinterner.h"
+#include "textkernels.h"
 
 Q_LOGGING_CATEGORY(logDesktopFileParser, "dde.am.desktopfile.parser")
 using namespace Qt::StringLiterals;
@@ -146,12 +148,13 @@ ParserError DesktopFileParser::addGroup(Groups &groups, QString &groupName) noex
         qCDebug(logDesktopFileParser) << "Invalid desktop file format: unexpected line:" << toUtf8String(m_line);
         return ParserError::InvalidFormat;
     }
+    m_contentHash = qHash(m_line, m_contentHash);
 
     // Parsing group header.
     // https://specifications.freedesktop.org/desktop-entry-spec/desktop-entry-spec-latest.html#group-header
 
     const auto groupNameBytes = m_line.sliced(1, m_line.size() - 2).trimmed();
-    if (std::any_of(groupNameBytes.cbegin(), groupNameBytes.cend(), [](auto ch) { return ch == '[' || ch == ']'; })) {
+    if (TextKernels::indexOf(groupNameBytes, '[') != -1 || TextKernels::indexOf(groupNameBytes, ']') != -1) {
         qCDebug(logDesktopFileParser) << "group header invalid:" << toUtf8String(m_line);
         return ParserError::InvalidFormat;
     }
@@ -162,6 +165,8 @@ ParserError DesktopFileParser::addGroup(Groups &groups, QString &groupName) noex
         return ParserError::InvalidFormat;
     }
 
+    groupName = StringInterner::instance().intern(groupNameBytes);
+    groupNameView = groupName;
     auto group = groups.find(groupName);
     if (group != groups.end()) {
         qCDebug(logDesktopFileParser) << "duplicated group header detected:" << groupNameView;
@@ -194,7 +199,8 @@ ParserError DesktopFileParser::addGroup(Groups &groups, QString &groupName) noex
 
 ParserError DesktopFileParser::addEntry(Groups::iterator group) noexcept
 {
-    const auto splitCharIndex = m_line.indexOf('=');
+    m_contentHash = qHash(m_line, m_contentHash);
+    const auto splitCharIndex = TextKernels::indexOf(m_line, '=');
     if (splitCharIndex == -1) {
         qCDebug(logDesktopFileParser) << "invalid line in desktop file, skip it:" << toUtf8String(m_line);
         clearLine();
@@ -207,7 +213,7 @@ ParserError DesktopFileParser::addEntry(Groups::iterator group) noexcept
     // NOTE:
     // We are process "localized keys" here, for usage check:
     // https://specifications.freedesktop.org/desktop-entry/latest/localized-keys.html
-    const qsizetype localeBegin = keyBytes.indexOf('[');
+    const qsizetype localeBegin = TextKernels::indexOf(keyBytes, '[');
     const qsizetype localeEnd = keyBytes.lastIndexOf(']');
     if ((localeBegin == -1) != (localeEnd == -1)) {
         qCDebug(logDesktopFileParser) << "unmatched [] detected in desktop file, skip this line: " << toUtf8String(m_line);
@@ -218,23 +224,23 @@ ParserError DesktopFileParser::addEntry(Groups::iterator group) noexcept
 
     const bool hasLocaleKey = localeBegin != -1;
     QByteArrayView mainKeyBytes = keyBytes;
+    QByteArrayView localeBytes;
     QString localeKey;
     QStringView localeKeyView;
     if (hasLocaleKey) {
         mainKeyBytes = keyBytes.sliced(0, localeBegin).trimmed();
-        localeKey = toLatin1String(keyBytes.sliced(localeBegin + 1, localeEnd - localeBegin - 1).trimmed());
+        localeBytes = keyBytes.sliced(localeBegin + 1, localeEnd - localeBegin - 1).trimmed();
+        localeKey = toLatin1String(localeBytes);
     } else {
         localeKey = fromStaticRaw(DesktopFileDefaultKeyLocale);
     }
     localeKeyView = localeKey;
 
-    for (auto ch : mainKeyBytes) {
-        if ((ch < 'A' || ch > 'Z') && (ch < 'a' || ch > 'z') && (ch < '0' || ch > '9') && ch != '-') {
-            clearLine();
-            qCDebug(logDesktopFileParser).noquote()
-                << QString(u"invalid KEY (%2) for key \"%1\"").arg(toUtf8String(keyBytes), toUtf8String(mainKeyBytes));
-            return ParserError::NoError;
-        }
+    if (!TextKernels::isValidKey(mainKeyBytes)) {
+        clearLine();
+        qCDebug(logDesktopFileParser).noquote()
+            << QString(u"invalid KEY (%2) for key \"%1\"").arg(toUtf8String(keyBytes), toUtf8String(mainKeyBytes));
+        return ParserError::NoError;
     }
 
     if (hasLocaleKey) {
@@ -244,47 +250,67 @@ ParserError DesktopFileParser::addEntry(Groups::iterator group) noexcept
                 << QString(u"invalid LOCALE (%2) for key \"%1\"").arg(toUtf8String(keyBytes), localeKeyView);
             return ParserError::NoError;
         }
+
+        localeKey = StringInterner::instance().intern(localeBytes);
+        localeKeyView = localeKey;
     }
 
-    const auto mainKey = toLatin1String(mainKeyBytes);
+    const auto mainKey = StringInterner::instance().intern(mainKeyBytes);
     const auto mainKeyView = QStringView{mainKey};
     const auto supportsLocale{isLocaleString(mainKeyView)};
     auto valVariant = group->lowerBound(mainKey);
     const bool keyExists = valVariant != group->end() && valVariant.key() == mainKey;
 
-    if (keyExists) {
-        if (!supportsLocale) {
-            qCDebug(logDesktopFileParser) << "duplicate key:" << mainKeyView << "skip.";
-            clearLine();
-            return ParserError::NoError;
-        }
-
-        auto &val = valVariant.value();
-        // maybe custom key has locale string, try to promote it to QStringMap
-        if (val.userType() != QMetaType::fromType<QStringMap>().id()) {
-            QStringMap newMap{{fromStaticRaw(DesktopFileDefaultKeyLocale), val.toString()}};
-            val = QVariant::fromValue(std::move(newMap));
-        }
+    // QStringMap/QString for eager decoding, EncodedLocaleMap/EncodedValue for lazy decoding.
+    auto insertValue = [&](auto &&value) {
+        using ValueType = std::decay_t<decltype(value)>;
+        using MapType = QMap<QString, ValueType>;
+
+        if (keyExists) {
+            auto &val = valVariant.value();
+            // maybe custom key has locale string, try to promote it to a locale map
+            if (val.userType() != QMetaType::fromType<MapType>().id()) {
+                MapType newMap{{fromStaticRaw(DesktopFileDefaultKeyLocale), val.template value<ValueType>()}};
+                val = QVariant::fromValue(std::move(newMap));
+            }
 
-        auto *map = static_cast<QStringMap *>(val.data());
-        auto localeIt = map->lowerBound(localeKey);
-        if (localeIt != map->end() && localeIt.key() == localeKey) {
-            qCDebug(logDesktopFileParser) << "duplicate locale key:" << mainKeyView << "[" << localeKeyView << "]";
+            auto *map = static_cast<MapType *>(val.data());
+            auto localeIt = map->lowerBound(localeKey);
+            if (localeIt != map->end() && localeIt.key() == localeKey) {
+                qCDebug(logDesktopFileParser) << "duplicate locale key:" << mainKeyView << "[" << localeKeyView << "]";
+            } else {
+                map->insert(localeIt, localeKey, std::forward<decltype(value)>(value));
+            }
+        } else if (supportsLocale) {
+            group->insert(valVariant, mainKey, QVariant::fromValue(MapType{{localeKey, std::forward<decltype(value)>(value)}}));
         } else {
-            map->insert(localeIt, localeKey, toUtf8String(valueBytes));
+            group->insert(valVariant, mainKey, QVariant::fromValue(std::forward<decltype(value)>(value)));
         }
+    };
+
+    if (keyExists && !supportsLocale) {
+        qCDebug(logDesktopFileParser) << "duplicate key:" << mainKeyView << "skip.";
+        clearLine();
+        return ParserError::NoError;
+    }
+
+    if (m_decoding == ValueDecoding::Eager) {
+        insertValue(toUtf8String(valueBytes));
     } else {
-        if (supportsLocale) {
-            group->insert(valVariant, mainKey, QVariant::fromValue(QStringMap{{localeKey, toUtf8String(valueBytes)}}));
-        } else {
-            group->insert(valVariant, mainKey, toUtf8String(valueBytes));
-        }
+        insertValue(encodedValue(valueBytes));
     }
 
     clearLine();
     return ParserError::NoError;
 }
 
+EncodedValue DesktopFileParser::encodedValue(QByteArrayView valueBytes) const noexcept
+{
+    // valueBytes is a slice of m_content, share the backing instead of copying it.
+    const auto offset = valueBytes.isEmpty() ? 0 : valueBytes.data() - m_content.data();
+    return EncodedValue{m_backing, offset, valueBytes.size(), m_decoding == ValueDecoding::LazyMemoized};
+}
+
 QString toString(const DesktopFileParser::Groups &groups)
 {
     if (groups.isEmpty()) {
@@ -314,9 +340,21 @@ QString toString(const DesktopFileParser::Groups &groups)
 
                     ret.append(u'=' % locValue % u'\n');
                 }
+            } else if (typeId == QMetaType::fromType<EncodedLocaleMap>().id()) {
+                const auto &rawMap = *static_cast<const EncodedLocaleMap *>(value.constData());
+                for (const auto &[locKey, locValue] : rawMap.asKeyValueRange()) {
+                    ret.append(key);
+                    if (locKey != defaultLoc) {
+                        ret.append(u'[' % locKey % u']');
+                    }
+
+                    ret.append(u'=' % locValue.decoded() % u'\n');
+                }
             } else if (typeId == QMetaType::QStringList) {
                 const auto &list = *static_cast<const QStringList *>(value.constData());
                 ret.append(key % u'=' % list.join(u';') % u'\n');
+            } else if (typeId == QMetaType::fromType<EncodedValue>().id()) {
+                ret.append(key % u'=' % static_cast<const EncodedValue *>(value.constData())->decoded() % u'\n');
             } else {
                 ret.append(key % u'=' % value.toString() % u'\n');
             }
@@ -337,11 +375,18 @@ QString toString(const DesktopFileParser::Groups &groups)
     auto actionsIt = mainEntryIt->constFind(fromStaticRaw(DesktopEntryActions));
     if (actionsIt != mainEntryIt->cend()) {
         const auto &actionValue = actionsIt.value();
-        if (actionValue.userType() != QMetaType::QString) {
-            qCWarning(logDesktopFileParser) << "Actions entry is not stored as QString, serializing via toString():"
-                                            << actionValue.metaType().name();
+        QString actionsString;
+        // lazily decoded entries keep it as an EncodedValue, which is a string as well.
+        if (actionValue.userType() == QMetaType::fromType<EncodedValue>().id()) {
+            actionsString = static_cast<const EncodedValue *>(actionValue.constData())->decoded();
+        } else {
+            if (actionValue.userType() != QMetaType::QString) {
+                qCWarning(logDesktopFileParser) << "Actions entry is not stored as QString, serializing via toString():"
+                                                << actionValue.metaType().name();
+            }
+            actionsString = actionValue.toString();
         }
-        const auto actions = actionValue.toString().split(u';', Qt::SkipEmptyParts);
+        const auto actions = actionsString.split(u';', Qt::SkipEmptyParts);
 
         for (const auto &action : actions) {
             if (action.isEmpty()) {
@@ -11,12 +11,24 @@
 class DesktopFileParser final : public Parser<DesktopEntry::Value>
 {
 public:
-    using Parser<DesktopEntry::Value>::Parser;
+    explicit DesktopFileParser(QFile &file, ValueDecoding decoding = ValueDecoding::Eager)
+        // lazy values keep slices of the content, don't map the file since it may be truncated later.
+        : Parser<DesktopEntry::Value>(file, decoding == ValueDecoding::Eager)
+        , m_decoding(decoding)
+    {
+    }
     ParserError parse(Groups &ret) noexcept override;
+    // hash of every group header and entry line in the file, comments and blank lines don't contribute.
+    [[nodiscard]] std::size_t contentHash() const noexcept { return m_contentHash; }
 
 protected:
     ParserError addGroup(Groups &groups, QString &groupName) noexcept override;
     ParserError addEntry(Groups::iterator groups) noexcept override;
+
+private:
+    [[nodiscard]] EncodedValue encodedValue(QByteArrayView valueBytes) const noexcept;
+    ValueDecoding m_decoding;
+    std::size_t m_contentHash{0};
 };
 
 QString toString(const DesktopFileParser::Groups &groups);
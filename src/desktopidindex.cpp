@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopidindex.h"
+
+DesktopIdIndex &DesktopIdIndex::instance() noexcept
+{
+    static DesktopIdIndex index;
+    return index;
+}
+
+void DesktopIdIndex::reset(QHash<QString, QString> paths) noexcept
+{
+    QWriteLocker locker{&m_lock};
+    m_paths = std::move(paths);
+    m_populated = true;
+}
+
+void DesktopIdIndex::insert(const QString &desktopId, const QString &path) noexcept
+{
+    QWriteLocker locker{&m_lock};
+    m_paths.insert(desktopId, path);
+}
+
+void DesktopIdIndex::remove(const QString &desktopId) noexcept
+{
+    QWriteLocker locker{&m_lock};
+    m_paths.remove(desktopId);
+}
+
+void DesktopIdIndex::clear() noexcept
+{
+    QWriteLocker locker{&m_lock};
+    m_paths.clear();
+    m_populated = false;
+}
+
+QString DesktopIdIndex::path(const QString &desktopId) const noexcept
+{
+    QReadLocker locker{&m_lock};
+    return m_paths.value(desktopId);
+}
+
+bool DesktopIdIndex::isPopulated() const noexcept
+{
+    QReadLocker locker{&m_lock};
+    return m_populated;
+}
+
+qsizetype DesktopIdIndex::size() const noexcept
+{
+    QReadLocker locker{&m_lock};
+    return m_paths.size();
+}
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DESKTOPIDINDEX_H
+#define DESKTOPIDINDEX_H
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+
+// Process-wide map from desktop ID to the file which provides it.
+// The daemon fills it while scanning applications and keeps it current on reload, so an ID lookup
+// is a hash lookup instead of probing every applications directory for every hyphen/slash permutation.
+// Paths must already be resolved with XDG precedence, the index doesn't look at the file system.
+// Helper processes never scan, so DesktopFile::searchDesktopFileById still probes the directories there.
+class DesktopIdIndex
+{
+public:
+    DesktopIdIndex(const DesktopIdIndex &) = delete;
+    DesktopIdIndex(DesktopIdIndex &&) = delete;
+    DesktopIdIndex &operator=(const DesktopIdIndex &) = delete;
+    DesktopIdIndex &operator=(DesktopIdIndex &&) = delete;
+    ~DesktopIdIndex() = default;
+
+    static DesktopIdIndex &instance() noexcept;
+
+    // replaces the whole index with the result of a full scan.
+    void reset(QHash<QString, QString> paths) noexcept;
+    void insert(const QString &desktopId, const QString &path) noexcept;
+    void remove(const QString &desktopId) noexcept;
+    void clear() noexcept;
+
+    // returns an empty string if the ID isn't known.
+    [[nodiscard]] QString path(const QString &desktopId) const noexcept;
+    // an unpopulated index knows nothing, callers have to fall back to the file system.
+    [[nodiscard]] bool isPopulated() const noexcept;
+    [[nodiscard]] qsizetype size() const noexcept;
+
+private:
+    DesktopIdIndex() = default;
+    mutable QReadWriteLock m_lock;
+    QHash<QString, QString> m_paths;
+    bool m_populated{false};
+};
+
+#endif
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dpkgstatusindex.h"
+#include "filecontent.h"
+#include "textkernels.h"
+#include <QFile>
+#include <QLoggingCategory>
+#include <QMutexLocker>
+#include <sys/stat.h>
+
+Q_LOGGING_CATEGORY(logDpkgStatus, "dde.am.dpkg.status")
+
+namespace {
+struct Stanza
+{
+    QByteArrayView package;
+    QByteArrayView version;
+    QByteArrayView status;
+};
+
+// returns the value if line is the field name, continuation lines never match.
+std::optional<QByteArrayView> fieldValue(QByteArrayView line, QByteArrayView name) noexcept
+{
+    if (line.size() <= name.size() || !line.startsWith(name) || line[name.size()] != ':') {
+        return std::nullopt;
+    }
+    return line.sliced(name.size() + 1).trimmed();
+}
+
+void commit(const Stanza &stanza, QHash<QString, QString> &versions) noexcept
+{
+    // e.g. "install ok installed", "deinstall ok config-files".
+    if (stanza.package.isEmpty() || stanza.version.isEmpty() || !stanza.status.endsWith(" installed")) {
+        return;
+    }
+
+    const auto package = QString::fromLatin1(stanza.package);
+    if (!versions.contains(package)) {
+        versions.insert(package, QString::fromUtf8(stanza.version));
+    }
+}
+}  // namespace
+
+DpkgStatusIndex::DpkgStatusIndex(QString path) noexcept
+    : m_path(std::move(path))
+{
+}
+
+QHash<QString, QString> DpkgStatusIndex::parse(QByteArrayView content) noexcept
+{
+    QHash<QString, QString> versions;
+    Stanza stanza;
+    qsizetype begin{0};
+    while (begin <= content.size()) {
+        auto end = TextKernels::indexOf(content, '\n', begin);
+        if (end == -1) {
+            end = content.size();
+        }
+
+        auto line = content.sliced(begin, end - begin);
+        if (line.endsWith('\r')) {
+            line.chop(1);
+        }
+        begin = end + 1;
+
+        // stanzas are separated by an empty line.
+        if (line.isEmpty()) {
+            commit(stanza, versions);
+            stanza = {};
+            continue;
+        }
+
+        if (auto package = fieldValue(line, "Package"); package) {
+            stanza.package = *package;
+        } else if (auto version = fieldValue(line, "Version"); version) {
+            stanza.version = *version;
+        } else if (auto status = fieldValue(line, "Status"); status) {
+            stanza.status = *status;
+        }
+    }
+
+    commit(stanza, versions);
+    return versions;
+}
+
+std::optional<QString> DpkgStatusIndex::version(const QString &package) noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    refresh();
+    if (auto it = m_versions.constFind(package); it != m_versions.cend()) {
+        return it.value();
+    }
+    return std::nullopt;
+}
+
+void DpkgStatusIndex::refresh() noexcept
+{
+    struct stat info{};
+    if (::stat(m_path.toLocal8Bit().constData(), &info) == -1) {
+        if (m_stamp) {
+            qCInfo(logDpkgStatus) << m_path << "isn't available anymore.";
+        }
+        m_stamp.reset();
+        m_versions.clear();
+        return;
+    }
+
+    const Stamp stamp{static_cast<quint64>(info.st_dev),
+                      static_cast<quint64>(info.st_ino),
+                      static_cast<qint64>(info.st_size),
+                      static_cast<qint64>(info.st_mtim.tv_sec) * 1'000'000'000 + info.st_mtim.tv_nsec};
+    if (m_stamp && *m_stamp == stamp) {
+        return;
+    }
+
+    QFile file{m_path};
+    if (!file.open(QFile::ReadOnly)) {
+        qCWarning(logDpkgStatus) << "open" << m_path << "failed:" << file.errorString();
+        return;
+    }
+
+    // dpkg replaces the database by renaming a new file, the mapped one is never truncated in place.
+    const auto content = FileContent::load(file, true);
+    m_versions = content ? parse(content->view()) : QHash<QString, QString>{};
+    m_stamp = stamp;
+    qCDebug(logDpkgStatus) << "indexed" << m_versions.size() << "installed packages from" << m_path;
+}
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DPKGSTATUSINDEX_H
+#define DPKGSTATUSINDEX_H
+
+#include <QByteArrayView>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <optional>
+
+// Installed version of every deb package, read from the status database of dpkg instead of running dpkg-query.
+// The database is parsed again once it's replaced or modified, dpkg rewrites it after every transaction.
+// It's thread safe.
+class DpkgStatusIndex
+{
+public:
+    explicit DpkgStatusIndex(QString path = QStringLiteral("/var/lib/dpkg/status")) noexcept;
+
+    // std::nullopt if the package isn't installed or the database isn't available.
+    [[nodiscard]] std::optional<QString> version(const QString &package) noexcept;
+
+    // package -> version of the installed packages, the first one wins for a package of several architectures.
+    [[nodiscard]] static QHash<QString, QString> parse(QByteArrayView content) noexcept;
+
+private:
+    struct Stamp
+    {
+        quint64 device{0};
+        quint64 inode{0};
+        qint64 size{0};
+        qint64 mtimeNs{0};
+
+        bool operator==(const Stamp &other) const noexcept
+        {
+            return device == other.device && inode == other.inode && size == other.size && mtimeNs == other.mtimeNs;
+        }
+    };
+
+    void refresh() noexcept;
+
+    QMutex m_mutex;
+    QString m_path;
+    std::optional<Stamp> m_stamp;
+    QHash<QString, QString> m_versions;
+};
+
+#endif
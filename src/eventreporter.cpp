@@ -5,19 +5,21 @@
 #include "eventreporter.h"
 #include "config.h"
 #include "constant.h"
+#include "dconfigcache.h"
 #include "global.h"
 
 #ifdef HAVE_DDE_API_EVENTLOGGER
 #include <dde-api/eventlogger.hpp>
 #endif
-#include <DConfig>
 
+#include <QCoreApplication>
 #include <QLoggingCategory>
 #include <QDateTime>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QProcess>
 #include <QHash>
+#include <QtConcurrent>
 #include <algorithm>
 #include <memory>
 
@@ -31,18 +33,25 @@ EventReporter &EventReporter::instance()
 
 void EventReporter::initialize()
 {
-    DCORE_USE_NAMESPACE
-    std::unique_ptr<DConfig> config(DConfig::create(
-        fromStaticRaw(ApplicationServiceID),
-        fromStaticRaw(ApplicationManagerConfig)));
-
-    if (!config || !config->isValid()) {
+    auto &cache = DConfigCache::instance();
+    auto *config = cache.config({});
+    if (config == nullptr) {
         qCInfo(amEventReporter) << "DConfig not available, skip event filter disabled.";
         return;
     }
 
     m_skipEventAppIds = config->value(fromStaticRaw(SkipEventAppIds)).toStringList();
     qCInfo(amEventReporter) << "skip event appIds:" << m_skipEventAppIds;
+
+    // reloading applications calls it again, follow the changes of the cached config instead of reading it every time.
+    if (!m_followsConfig) {
+        m_followsConfig = true;
+        QObject::connect(&cache, &DConfigCache::valueChanged, &cache, [this](const QString &subpath, const QString &key) {
+            if (subpath.isEmpty() && key == fromStaticRaw(SkipEventAppIds)) {
+                initialize();
+            }
+        });
+    }
 }
 
 bool EventReporter::shouldSkip(const QString &appId) const
@@ -58,24 +67,42 @@ bool EventReporter::shouldSkip(const QString &appId) const
     return false;
 }
 
-EventReporter::CacheEntry EventReporter::queryAppPackageInfo(const QString &appId, bool isLinglong)
+void EventReporter::withAppPackageInfo(const QString &appId, bool isLinglong, PendingReport report)
 {
-    auto cacheIt = m_cache.constFind(appId);
-    if (cacheIt != m_cache.constEnd()) {
-        qint64 age = QDateTime::currentMSecsSinceEpoch() - cacheIt->timestamp;
+    if (auto pending = m_pendingReports.find(appId); pending != m_pendingReports.end()) {
+        pending->append(std::move(report));
+        return;
+    }
+
+    CacheEntry previous;
+    if (auto cacheIt = m_cache.find(appId); cacheIt != m_cache.end()) {
+        const auto now = QDateTime::currentMSecsSinceEpoch();
+        qint64 age = now - cacheIt->timestamp;
         if (age < kCacheTimeoutMs) {
-            m_cache[appId].timestamp = QDateTime::currentMSecsSinceEpoch();
-            return *cacheIt;
+            cacheIt->timestamp = now;
+            report(*cacheIt);
+            return;
         }
         qCDebug(amEventReporter) << "cache stale for appId:" << appId << "age:" << age << "ms";
+        previous = *cacheIt;
     }
 
-    CacheEntry info;
-    if (cacheIt != m_cache.constEnd()) {
-        info.version = cacheIt->version;
-        info.pakType = cacheIt->pakType;
-    }
+    // ll-cli takes up to seconds, Launch mustn't wait for it in the main thread.
+    m_pendingReports.insert(appId, {std::move(report)});
+    QtConcurrent::run([this, appId, isLinglong, previous = std::move(previous)]() mutable {
+        return queryAppPackageInfo(appId, isLinglong, std::move(previous));
+    }).then(QCoreApplication::instance(), [this, appId](const CacheEntry &info) {
+        storeAppPackageInfo(appId, info);
+        const auto reports = m_pendingReports.take(appId);
+        for (const auto &report : reports) {
+            report(info);
+        }
+    });
+}
 
+EventReporter::CacheEntry EventReporter::queryAppPackageInfo(const QString &appId, bool isLinglong, CacheEntry previous)
+{
+    CacheEntry info = std::move(previous);
     qCDebug(amEventReporter) << "query package info for appId:" << appId;
 
     if (isLinglong) {
@@ -95,30 +122,27 @@ EventReporter::CacheEntry EventReporter::queryAppPackageInfo(const QString &appI
         } else {
             qCWarning(amEventReporter) << "ll-cli query failed for" << appId << "exitCode:" << proc.exitCode();
         }
+    } else if (auto version = m_dpkgStatus.version(appId); version) {
+        info.version = std::move(version).value();
+        info.pakType = "deb";
     } else {
-        QProcess proc;
-        proc.start("dpkg-query", {"-W", "-f=${Version}", appId});
-        if (!proc.waitForStarted(1000)) {
-            qCWarning(amEventReporter) << "dpkg-query failed to start for" << appId;
-        } else if (!proc.waitForFinished(1000)) {
-            qCWarning(amEventReporter) << "dpkg-query timeout for" << appId;
-            proc.kill();
-        } else if (proc.exitCode() == 0) {
-            info.version = QString::fromUtf8(proc.readAllStandardOutput()).trimmed();
-            info.pakType = "deb";
-        } else {
-            qCWarning(amEventReporter) << "dpkg-query failed for" << appId << "exitCode:" << proc.exitCode();
-        }
+        qCDebug(amEventReporter) << "no installed deb package of" << appId;
     }
 
     if (info.pakType.isEmpty()) {
         info.pakType = "unknown";
     }
 
-    info.timestamp = QDateTime::currentMSecsSinceEpoch();
+    return info;
+}
+
+void EventReporter::storeAppPackageInfo(const QString &appId, const CacheEntry &info)
+{
+    auto entry = info;
+    entry.timestamp = QDateTime::currentMSecsSinceEpoch();
 
     // LRU eviction: if it's a new entry and at capacity, remove the oldest
-    if (cacheIt == m_cache.constEnd() && m_cache.size() >= kMaxCacheSize) {
+    if (!m_cache.contains(appId) && m_cache.size() >= kMaxCacheSize) {
         auto oldest = std::min_element(m_cache.constKeyValueBegin(),
                                        m_cache.constKeyValueEnd(),
                                        [](const auto &a, const auto &b) {
@@ -130,8 +154,7 @@ EventReporter::CacheEntry EventReporter::queryAppPackageInfo(const QString &appI
         }
     }
 
-    m_cache.insert(appId, info);
-    return info;
+    m_cache.insert(appId, entry);
 }
 
 void EventReporter::reportAppLaunch(const QString &appName, qint64 timeMs, bool isLinglong, const QString &launchType, const QString &uniqueID)
@@ -140,18 +163,19 @@ void EventReporter::reportAppLaunch(const QString &appName, qint64 timeMs, bool
     if (shouldSkip(appName))
         return;
 
-    auto info = queryAppPackageInfo(appName, isLinglong);
-    DDE_EventLogger::EventLogger::instance().writeEventLog({
-        1000610001,
-        appName,
-        QJsonObject{
-            {"app_name", appName},
-            {"launch_type", launchType},
-            {"app_version", info.version},
-            {"unique_id", uniqueID},
-            {"time", timeMs},
-            {"app_package_type", info.pakType},
-        },
+    withAppPackageInfo(appName, isLinglong, [appName, timeMs, launchType, uniqueID](const CacheEntry &info) {
+        DDE_EventLogger::EventLogger::instance().writeEventLog({
+            1000610001,
+            appName,
+            QJsonObject{
+                {"app_name", appName},
+                {"launch_type", launchType},
+                {"app_version", info.version},
+                {"unique_id", uniqueID},
+                {"time", timeMs},
+                {"app_package_type", info.pakType},
+            },
+        });
     });
 #else
     Q_UNUSED(appName)
@@ -167,18 +191,19 @@ void EventReporter::reportAppLaunchFailed(const QString &appName, const QString
     if (shouldSkip(appName))
         return;
 
-    auto info = queryAppPackageInfo(appName, isLinglong);
-    DDE_EventLogger::EventLogger::instance().writeEventLog({
-        1000610002,
-        appName,
-        QJsonObject{
-            {"app_name", appName},
-            {"launch_type", launchType},
-            {"app_version", info.version},
-            {"unique_id", uniqueID},
-            {"errors", errors},
-            {"app_package_type", info.pakType},
-        },
+    withAppPackageInfo(appName, isLinglong, [appName, errors, launchType, uniqueID](const CacheEntry &info) {
+        DDE_EventLogger::EventLogger::instance().writeEventLog({
+            1000610002,
+            appName,
+            QJsonObject{
+                {"app_name", appName},
+                {"launch_type", launchType},
+                {"app_version", info.version},
+                {"unique_id", uniqueID},
+                {"errors", errors},
+                {"app_package_type", info.pakType},
+            },
+        });
     });
 #else
     Q_UNUSED(appName)
@@ -194,18 +219,19 @@ void EventReporter::reportAppAbnormalExit(const QString &appName, const QString
     if (shouldSkip(appName))
         return;
 
-    auto info = queryAppPackageInfo(appName, isLinglong);
-    DDE_EventLogger::EventLogger::instance().writeEventLog({
-        1000600012,
-        appName,
-        QJsonObject{
-            {"app_name", appName},
-            {"launch_type", launchType},
-            {"unique_id", uniqueID},
-            {"exec", exec},
-            {"log", logInfo},
-            {"app_package_type", info.pakType},
-        },
+    withAppPackageInfo(appName, isLinglong, [appName, launchType, exec, logInfo, uniqueID](const CacheEntry &info) {
+        DDE_EventLogger::EventLogger::instance().writeEventLog({
+            1000600012,
+            appName,
+            QJsonObject{
+                {"app_name", appName},
+                {"launch_type", launchType},
+                {"unique_id", uniqueID},
+                {"exec", exec},
+                {"log", logInfo},
+                {"app_package_type", info.pakType},
+            },
+        });
     });
 #else
     Q_UNUSED(appName)
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "dpkgstatusindex.h"
 #include <QHash>
+#include <QList>
 #include <QString>
 #include <QStringList>
+#include <functional>
 
 class EventReporter
 {
@@ -27,10 +30,20 @@ private:
         qint64 timestamp = 0;
     };
 
+    using PendingReport = std::function<void(const CacheEntry &)>;
+
     bool shouldSkip(const QString &appId) const;
-    CacheEntry queryAppPackageInfo(const QString &appId, bool isLinglong);
+    // calls report with the package info of appId, at once if it's cached, otherwise once a worker resolved it.
+    // Reports of the same application are kept in order.
+    void withAppPackageInfo(const QString &appId, bool isLinglong, PendingReport report);
+    // runs in the thread pool, previous is the stale entry which is kept if the query fails.
+    CacheEntry queryAppPackageInfo(const QString &appId, bool isLinglong, CacheEntry previous);
+    void storeAppPackageInfo(const QString &appId, const CacheEntry &info);
 
     QStringList m_skipEventAppIds;
+    QHash<QString, QList<PendingReport>> m_pendingReports;
+    DpkgStatusIndex m_dpkgStatus;
+    bool m_followsConfig{false};
     QHash<QString, CacheEntry> m_cache;
 
     static constexpr int kMaxCacheSize = 128;
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "filecontent.h"
+#include <QLoggingCategory>
+#include <sys/mman.h>
+#include <cerrno>
+#include <cstring>
+
+Q_LOGGING_CATEGORY(logFileContent, "dde.am.filecontent")
+
+namespace {
+// a mapping costs a few syscalls and page faults, reading is cheaper for typical desktop files.
+constexpr qint64 MappingThreshold = 16 * 1024;
+}  // namespace
+
+FileContent::FileContent(const char *mapped, qsizetype size) noexcept
+    : m_data(mapped)
+    , m_size(size)
+    , m_mapped(true)
+{
+}
+
+FileContent::FileContent(QByteArray buffer) noexcept
+    : m_buffer(std::move(buffer))
+    , m_data(m_buffer.constData())
+    , m_size(m_buffer.size())
+{
+}
+
+FileContent::~FileContent()
+{
+    if (m_mapped) {
+        ::munmap(const_cast<char *>(m_data), static_cast<size_t>(m_size));
+    }
+}
+
+std::shared_ptr<const FileContent> FileContent::load(QFile &file, bool allowMapping) noexcept
+{
+    const auto size = file.size();
+    const auto fd = file.handle();
+
+    // pseudo filesystems like procfs and sysfs report an empty size, they're always read.
+    if (allowMapping && fd != -1 && size >= MappingThreshold && file.pos() == 0) {
+        auto *addr = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            ::madvise(addr, static_cast<size_t>(size), MADV_SEQUENTIAL);
+
+            auto *content = new (std::nothrow) FileContent{static_cast<const char *>(addr), size};
+            if (content == nullptr) {
+                ::munmap(addr, static_cast<size_t>(size));
+                return nullptr;
+            }
+
+            // keep the device state consistent with reading the whole file.
+            file.seek(size);
+            return std::shared_ptr<const FileContent>{content};
+        }
+
+        qCDebug(logFileContent) << "failed to map" << file.fileName() << ", fall back to read:" << std::strerror(errno);
+    }
+
+    auto buffer = file.readAll();
+    if (buffer.isEmpty()) {
+        return nullptr;
+    }
+
+    return fromByteArray(std::move(buffer));
+}
+
+std::shared_ptr<const FileContent> FileContent::fromByteArray(QByteArray data) noexcept
+{
+    auto *content = new (std::nothrow) FileContent{std::move(data)};
+    if (content == nullptr) {
+        return nullptr;
+    }
+
+    return std::shared_ptr<const FileContent>{content};
+}
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef FILECONTENT_H
+#define FILECONTENT_H
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFile>
+#include <memory>
+
+// Read-only content of a file, backed either by a private memory mapping or by a heap buffer.
+// It's shared through std::shared_ptr, so slices of the content can outlive the parser which loaded it.
+class FileContent
+{
+public:
+    FileContent(const FileContent &) = delete;
+    FileContent(FileContent &&) = delete;
+    FileContent &operator=(const FileContent &) = delete;
+    FileContent &operator=(FileContent &&) = delete;
+    ~FileContent();
+
+    // Maps the opened file when it's large enough and mapping is allowed, otherwise reads it.
+    // NOTE: A mapped file that is truncated in place raises SIGBUS on access,
+    // only allow mapping when the content won't be kept after parsing.
+    [[nodiscard]] static std::shared_ptr<const FileContent> load(QFile &file, bool allowMapping) noexcept;
+    [[nodiscard]] static std::shared_ptr<const FileContent> fromByteArray(QByteArray data) noexcept;
+
+    [[nodiscard]] QByteArrayView view() const noexcept { return QByteArrayView{m_data, m_size}; }
+    [[nodiscard]] bool isMapped() const noexcept { return m_mapped; }
+
+private:
+    FileContent(const char *mapped, qsizetype size) noexcept;
+    explicit FileContent(QByteArray buffer) noexcept;
+
+    QByteArray m_buffer;
+    const char *m_data{nullptr};
+    qsizetype m_size{0};
+    bool m_mapped{false};
+};
+
+#endif
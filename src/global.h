@@ -12,6 +12,7 @@
 #include <QDBusMessage>
 #include <QDBusObjectPath>
 #include <QDBusUnixFileDescriptor>
+#include <QDBusVirtualObject>
 #include <QStandardPaths>
 #include <QDir>
 #include <QLocale>
@@ -326,6 +327,8 @@ private:
 };
 
 bool registerObjectToDBus(QObject *o, const QString &path, const QString &interface) noexcept;
+// registers o to serve path itself, objects below path can still be registered.
+bool registerVirtualObjectToDBus(QDBusVirtualObject *o, const QString &path) noexcept;
 void unregisterObjectFromDBus(const QString &path) noexcept;
 
 inline const QString &getDBusInterface(const QMetaObject *meta) noexcept
@@ -353,6 +356,18 @@ inline const QString &getDBusInterface(const QMetaObject *meta) noexcept
     return interfaceCache[nullptr];  // NOLINT
 }
 
+inline QVariantMap getPropertiesFromAdaptor(const QObject *adaptor) noexcept
+{
+    const auto *mo = adaptor->metaObject();
+    QVariantMap properties;
+    for (auto i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
+        const auto prop = mo->property(i);
+        properties.insert(QString::fromUtf8(prop.name()), prop.read(adaptor));
+    }
+
+    return properties;
+}
+
 inline ObjectInterfaceMap getChildInterfacesAndPropertiesFromObject(const QObject *o) noexcept
 {
     if (Q_UNLIKELY(o == nullptr)) {
@@ -376,13 +391,7 @@ inline ObjectInterfaceMap getChildInterfacesAndPropertiesFromObject(const QObjec
             continue;
         }
 
-        QVariantMap properties;
-        for (auto i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
-            const auto prop = mo->property(i);
-            properties.insert(QString::fromUtf8(prop.name()), prop.read(child));
-        }
-
-        ret.insert(interface, properties);
+        ret.insert(interface, getPropertiesFromAdaptor(child));
     }
 
     return ret;
@@ -575,6 +584,12 @@ inline const QString &getXDGDataHome() noexcept
     return value;
 }
 
+inline const QString &getXDGCacheHome() noexcept
+{
+    static const auto &value{QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)};
+    return value;
+}
+
 inline const QStringList &getXDGDataDirs() noexcept
 {
     static const auto &value{QStandardPaths::standardLocations(QStandardPaths::GenericDataLocation)};
@@ -12,6 +12,9 @@
 #include <QString>
 #include <QStringView>
 #include <QFile>
+#include "filecontent.h"
+#include "textkernels.h"
+#include <memory>
 
 enum class ParserError : uint8_t {
     NoError,
@@ -29,8 +32,9 @@ template <typename Value>
 class Parser
 {
 public:
-    explicit Parser(QFile &file)
-        : m_file(file) {};
+    explicit Parser(QFile &file, bool allowMapping = true)
+        : m_file(file)
+        , m_allowMapping(allowMapping) {};
     virtual ~Parser() = default;
     using Groups = QMap<QString, QMap<QString, Value>>;
 
@@ -55,9 +59,8 @@ protected:
         ensureLoaded();
         while (m_offset < m_content.size()) {
             const auto lineBegin = m_offset;
-            while (m_offset < m_content.size() && m_content.at(m_offset) != '\n') {
-                ++m_offset;
-            }
+            const auto newline = TextKernels::indexOf(m_content, '\n', m_offset);
+            m_offset = newline == -1 ? m_content.size() : newline;
 
             auto lineEnd = m_offset;
             if (m_offset < m_content.size() && m_content.at(m_offset) == '\n') {
@@ -93,17 +96,20 @@ private:
         }
 
         m_loaded = true;
-        const auto content = m_file.readAll();
-        if (content.isEmpty()) {
+        m_backing = FileContent::load(m_file, m_allowMapping);
+        if (!m_backing) {
             return;
         }
 
-        m_content = content;
+        m_content = m_backing->view();
     }
 
 protected:
     QFile &m_file;
-    QByteArray m_content;
+    bool m_allowMapping;
+    // m_content views m_backing, subclasses can share m_backing to keep slices of the content alive.
+    std::shared_ptr<const FileContent> m_backing;
+    QByteArrayView m_content;
     QByteArrayView m_line;
     qsizetype m_offset{0};
     bool m_loaded{false};
@@ -115,26 +121,7 @@ inline bool hasNonAsciiAndControlCharacters(QStringView str) noexcept
         return false;
     }
 
-    bool hasControl{false};
-    bool hasNonAscii{false};
-
-    for (const auto &ch : str) {
-        const auto u = ch.unicode();
-
-        if (u > 127) {
-            hasNonAscii = true;
-        }
-
-        if (u <= 31 || (u >= 127 && u <= 159)) {
-            hasControl = true;
-        }
-
-        if (hasNonAscii && hasControl) {
-            return true;
-        }
-    }
-
-    return false;
+    return TextKernels::classify(str) == (TextKernels::NonAscii | TextKernels::Control);
 }
 
 inline QDebug operator<<(QDebug debug, const ParserError &v)
@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "launchhelperclient.h"
+#include "common/launchhelperprotocol.h"
+#include "global.h"
+#include <QLoggingCategory>
+#include <sys/socket.h>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+Q_LOGGING_CATEGORY(logLaunchHelper, "dde.am.launchhelper")
+
+using namespace Qt::StringLiterals;
+
+LaunchHelperClient::LaunchHelperClient(QObject *parent) noexcept
+    : QObject(parent)
+{
+    m_helper.setProgram(getApplicationLauncherBinary());
+    m_helper.setArguments({QString::fromLatin1(LaunchHelperProtocol::ServerOption)});
+    m_helper.setStandardInputFile(QProcess::nullDevice());
+    m_helper.setProcessChannelMode(QProcess::ForwardedChannels);
+
+    connect(&m_helper, &QProcess::finished, this, [this](int exitCode, QProcess::ExitStatus status) {
+        qCWarning(logLaunchHelper) << "app-launch-helper exited, code:" << exitCode << "status:" << status;
+        stop();
+    });
+}
+
+LaunchHelperClient::~LaunchHelperClient()
+{
+    m_helper.disconnect(this);
+    // the helper exits once its end of the socket is closed.
+    closeConnection();
+    if (m_helper.state() != QProcess::NotRunning && !m_helper.waitForFinished(1000)) {
+        m_helper.kill();
+        m_helper.waitForFinished(1000);
+    }
+}
+
+QByteArray LaunchHelperClient::encodeRequest(quint64 id, const QStringList &commandLine) noexcept
+{
+    QByteArray ret = QByteArray::number(id);
+    ret.append('\0');
+    for (const auto &arg : commandLine) {
+        ret.append(arg.toUtf8());
+        ret.append('\0');
+    }
+    return ret;
+}
+
+std::optional<LaunchHelperClient::Reply> LaunchHelperClient::decodeReply(QByteArrayView packet) noexcept
+{
+    if (packet.isEmpty() || packet.back() != '\0') {
+        return std::nullopt;
+    }
+
+    const auto idEnd = packet.indexOf('\0');
+    if (idEnd == packet.size() - 1) {
+        return std::nullopt;
+    }
+
+    bool ok{false};
+    const auto id = packet.first(idEnd).toULongLong(&ok);
+    if (!ok) {
+        return std::nullopt;
+    }
+
+    return Reply{id, QString::fromUtf8(packet.sliced(idEnd + 1).chopped(1))};
+}
+
+QFuture<QString> LaunchHelperClient::launch(const QStringList &commandLine) noexcept
+{
+    if (!ensureStarted()) {
+        return finishedLaunch(u"failed"_s);
+    }
+
+    const auto id = ++m_nextId;
+    const auto request = encodeRequest(id, commandLine);
+    if (static_cast<std::size_t>(request.size()) > LaunchHelperProtocol::MaxRequestSize) {
+        qCWarning(logLaunchHelper) << "command line of request" << id << "is too large.";
+        return finishedLaunch(u"invalidInput"_s);
+    }
+
+    if (::send(m_fd, request.constData(), request.size(), MSG_NOSIGNAL) == -1) {
+        const auto error = errno;
+        qCWarning(logLaunchHelper) << "send request to app-launch-helper failed:" << std::strerror(error);
+        // a full socket is only a busy helper, anything else is a broken connection.
+        if (error != EAGAIN && error != EWOULDBLOCK) {
+            stop();
+        }
+        return finishedLaunch(u"failed"_s);
+    }
+
+    auto &promise = m_pending[id];
+    auto future = promise.future();
+    promise.start();
+    return future;
+}
+
+bool LaunchHelperClient::ensureStarted() noexcept
+{
+    if (m_fd != -1) {
+        return true;
+    }
+
+    // e.g. the connection broke while the helper kept running, a QProcess can't be started twice.
+    if (m_helper.state() != QProcess::NotRunning) {
+        stop();
+    }
+
+    int fds[2]{-1, -1};
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0, fds) == -1) {
+        qCCritical(logLaunchHelper) << "socketpair failed:" << std::strerror(errno);
+        return false;
+    }
+
+    // dup2 drops FD_CLOEXEC, so only the copy on the standard input of the helper survives exec.
+    const int helperFd = fds[1];
+    m_helper.setChildProcessModifier([helperFd] { ::dup2(helperFd, STDIN_FILENO); });
+    m_helper.start();
+    ::close(helperFd);
+
+    if (!m_helper.waitForStarted()) {
+        qCCritical(logLaunchHelper) << "start app-launch-helper failed:" << m_helper.errorString();
+        ::close(fds[0]);
+        return false;
+    }
+
+    m_fd = fds[0];
+    m_notifier.reset(new (std::nothrow) QSocketNotifier{m_fd, QSocketNotifier::Read});
+    if (!m_notifier) {
+        qCCritical(logLaunchHelper) << "new QSocketNotifier failed.";
+        stop();
+        return false;
+    }
+
+    connect(m_notifier.get(), &QSocketNotifier::activated, this, &LaunchHelperClient::readReplies);
+    qCInfo(logLaunchHelper) << "app-launch-helper is started, pid:" << m_helper.processId();
+    return true;
+}
+
+void LaunchHelperClient::stop() noexcept
+{
+    closeConnection();
+
+    // the helper is useless without its connection, it's started again by the next launch.
+    if (m_helper.state() != QProcess::NotRunning) {
+        m_helper.kill();
+        m_helper.waitForFinished(1000);
+    }
+}
+
+void LaunchHelperClient::closeConnection() noexcept
+{
+    if (m_notifier) {
+        // it may be stopped by the notifier itself.
+        m_notifier->setEnabled(false);
+        m_notifier.release()->deleteLater();
+    }
+
+    if (m_fd != -1) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    // the helper can't report these launches anymore.
+    for (auto &[id, promise] : m_pending) {
+        promise.addResult(u"failed"_s);
+        promise.finish();
+    }
+    m_pending.clear();
+}
+
+void LaunchHelperClient::readReplies() noexcept
+{
+    char buffer[512];
+    while (m_fd != -1) {
+        const auto len = ::recv(m_fd, buffer, sizeof(buffer), 0);
+        if (len == -1 && errno == EINTR) {
+            continue;
+        }
+
+        if (len == -1) {
+            if (errno != EAGAIN) {
+                qCWarning(logLaunchHelper) << "read reply of app-launch-helper failed:" << std::strerror(errno);
+                stop();
+            }
+            return;
+        }
+
+        if (len == 0) {
+            qCWarning(logLaunchHelper) << "app-launch-helper closed the connection.";
+            stop();
+            return;
+        }
+
+        const auto reply = decodeReply(QByteArrayView{buffer, len});
+        if (!reply) {
+            qCWarning(logLaunchHelper) << "drop malformed reply of app-launch-helper.";
+            continue;
+        }
+
+        finish(reply->id, reply->result);
+    }
+}
+
+void LaunchHelperClient::finish(quint64 id, const QString &result) noexcept
+{
+    auto it = m_pending.find(id);
+    if (it == m_pending.end()) {
+        return;
+    }
+
+    auto promise = std::move(it->second);
+    m_pending.erase(it);
+    promise.addResult(result);
+    promise.finish();
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef LAUNCHHELPERCLIENT_H
+#define LAUNCHHELPERCLIENT_H
+
+#include "unitlauncher.h"
+#include <QByteArray>
+#include <QObject>
+#include <QProcess>
+#include <QPromise>
+#include <QSocketNotifier>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+// Launches applications through one long-lived app-launch-helper, which keeps the helper a separate process
+// without paying for fork, exec and a new bus connection on every launch.
+// The helper is started by the first launch and restarted by the next launch if it exits.
+class LaunchHelperClient : public QObject, public UnitLauncher
+{
+    Q_OBJECT
+public:
+    struct Reply
+    {
+        quint64 id;
+        QString result;
+    };
+
+    explicit LaunchHelperClient(QObject *parent = nullptr) noexcept;
+    ~LaunchHelperClient() override;
+    LaunchHelperClient(const LaunchHelperClient &) = delete;
+    LaunchHelperClient(LaunchHelperClient &&) = delete;
+    LaunchHelperClient &operator=(const LaunchHelperClient &) = delete;
+    LaunchHelperClient &operator=(LaunchHelperClient &&) = delete;
+
+    [[nodiscard]] QFuture<QString> launch(const QStringList &commandLine) noexcept override;
+
+    [[nodiscard]] static QByteArray encodeRequest(quint64 id, const QStringList &commandLine) noexcept;
+    [[nodiscard]] static std::optional<Reply> decodeReply(QByteArrayView packet) noexcept;
+
+private:
+    bool ensureStarted() noexcept;
+    // closes the connection and kills the helper.
+    void stop() noexcept;
+    // fails every pending launch, the helper exits once it notices.
+    void closeConnection() noexcept;
+    void readReplies() noexcept;
+    void finish(quint64 id, const QString &result) noexcept;
+
+    QProcess m_helper;
+    int m_fd{-1};
+    std::unique_ptr<QSocketNotifier> m_notifier;
+    quint64 m_nextId{0};
+    std::unordered_map<quint64, QPromise<QString>> m_pending;
+};
+
+#endif
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "launchtracer.h"
+#include <QLoggingCategory>
+#include <QMutexLocker>
+#include <QStringBuilder>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+Q_LOGGING_CATEGORY(logLaunchTrace, "dde.am.launch.trace")
+
+using namespace Qt::StringLiterals;
+
+namespace {
+// the stages which every successful launch goes through, the splash ones depend on the session.
+constexpr std::array RequiredStages{
+    LaunchStage::Options, LaunchStage::Exec, LaunchStage::Scheduled, LaunchStage::UnitStarted, LaunchStage::InstanceAdded};
+}  // namespace
+
+LaunchTracer &LaunchTracer::instance() noexcept
+{
+    static LaunchTracer tracer;
+    return tracer;
+}
+
+qint64 LaunchTracer::now() noexcept
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+QString LaunchTracer::stageName(LaunchStage stage) noexcept
+{
+    switch (stage) {
+    case LaunchStage::Options:
+        return u"options"_s;
+    case LaunchStage::Exec:
+        return u"exec"_s;
+    case LaunchStage::Scheduled:
+        return u"scheduled"_s;
+    case LaunchStage::SplashShown:
+        return u"splashShown"_s;
+    case LaunchStage::UnitStarted:
+        return u"unitStarted"_s;
+    case LaunchStage::InstanceAdded:
+        return u"instanceAdded"_s;
+    case LaunchStage::SplashClosed:
+        return u"splashClosed"_s;
+    case LaunchStage::Count:
+        break;
+    }
+    return {};
+}
+
+void LaunchTracer::Window::add(qint64 sample, qsizetype capacity) noexcept
+{
+    ++m_count;
+    if (m_samples.size() < capacity) {
+        m_samples.append(sample);
+        return;
+    }
+
+    m_samples[m_next] = sample;
+    m_next = (m_next + 1) % capacity;
+}
+
+LaunchTracer::Percentiles LaunchTracer::Window::percentiles() const noexcept
+{
+    Percentiles ret;
+    ret.count = m_count;
+    if (m_samples.isEmpty()) {
+        return ret;
+    }
+
+    auto sorted = m_samples;
+    std::sort(sorted.begin(), sorted.end());
+    // nearest rank.
+    auto at = [&sorted](double p) { return sorted[static_cast<qsizetype>(std::ceil(p * sorted.size())) - 1]; };
+    ret.p50 = at(0.5);
+    ret.p90 = at(0.9);
+    ret.p99 = at(0.99);
+    ret.max = sorted.constLast();
+    return ret;
+}
+
+void LaunchTracer::begin(const QString &instanceId, const QString &appId, qint64 receivedAt) noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    if (m_traces.size() >= MaxTraces && !m_traces.contains(instanceId)) {
+        evictOldest();
+    }
+
+    auto &trace = m_traces[instanceId];
+    trace.appId = appId;
+    trace.receivedAt = receivedAt;
+    trace.stages.fill(-1);
+    trace.logged = false;
+}
+
+void LaunchTracer::mark(const QString &instanceId, LaunchStage stage, qint64 at) noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    auto it = m_traces.find(instanceId);
+    if (it == m_traces.end() || it->has(stage)) {
+        // not launched by application manager, or the stage is reached again, e.g. a restarted unit.
+        return;
+    }
+
+    const auto index = static_cast<std::size_t>(stage);
+    const auto elapsed = std::max<qint64>(at - it->receivedAt, 0);
+    it->stages[index] = elapsed;
+    m_total[index].add(elapsed, TotalWindow);
+
+    auto app = m_applications.find(it->appId);
+    if (app == m_applications.end()) {
+        if (m_applications.size() >= MaxApplications) {
+            m_applications.erase(m_applications.begin());
+        }
+        app = m_applications.insert(it->appId, {});
+    }
+    (*app)[index].add(elapsed, ApplicationWindow);
+
+    if (!it->logged && std::all_of(RequiredStages.cbegin(), RequiredStages.cend(), [&it](LaunchStage required) {
+            return it->has(required);
+        })) {
+        log(instanceId, *it, u"launched");
+        it->logged = true;
+    }
+
+    // a shown splash is only closed later, keep the trace until then.
+    if (it->logged && (!it->has(LaunchStage::SplashShown) || it->has(LaunchStage::SplashClosed))) {
+        m_traces.erase(it);
+    }
+}
+
+void LaunchTracer::fail(const QString &instanceId, const QString &reason) noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    if (auto it = m_traces.find(instanceId); it != m_traces.end()) {
+        log(instanceId, *it, QString{u"failed: "_s % reason});
+        m_traces.erase(it);
+    }
+}
+
+QMap<QString, LaunchTracer::Percentiles> LaunchTracer::statistics(const QString &appId) const noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    const StageWindows *windows{&m_total};
+    if (!appId.isEmpty()) {
+        auto it = m_applications.constFind(appId);
+        if (it == m_applications.cend()) {
+            return {};
+        }
+        windows = &it.value();
+    }
+
+    QMap<QString, Percentiles> ret;
+    for (std::size_t i = 0; i < StageCount; ++i) {
+        if (auto percentiles = (*windows)[i].percentiles(); percentiles.count != 0) {
+            ret.insert(stageName(static_cast<LaunchStage>(i)), percentiles);
+        }
+    }
+    return ret;
+}
+
+void LaunchTracer::reset() noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    m_total = {};
+    m_applications.clear();
+}
+
+qsizetype LaunchTracer::pendingCount() const noexcept
+{
+    const QMutexLocker locker{&m_mutex};
+    return m_traces.size();
+}
+
+void LaunchTracer::evictOldest() noexcept
+{
+    auto oldest = std::min_element(m_traces.begin(), m_traces.end(), [](const Trace &lhs, const Trace &rhs) {
+        return lhs.receivedAt < rhs.receivedAt;
+    });
+    if (oldest == m_traces.end()) {
+        return;
+    }
+
+    if (!oldest->logged) {
+        log(oldest.key(), *oldest, u"incomplete");
+    }
+    m_traces.erase(oldest);
+}
+
+void LaunchTracer::log(const QString &instanceId, const Trace &trace, QStringView outcome) noexcept
+{
+    QString stages;
+    for (std::size_t i = 0; i < StageCount; ++i) {
+        if (trace.stages[i] == -1) {
+            continue;
+        }
+        stages += u' ' % stageName(static_cast<LaunchStage>(i)) % u'=' %
+                  QString::number(static_cast<double>(trace.stages[i]) / 1000, 'f', 3) % u"ms";
+    }
+
+    qCInfo(logLaunchTrace).noquote() << "launch" << trace.appId << instanceId << outcome << "|" << stages.trimmed();
+}
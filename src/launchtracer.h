@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef LAUNCHTRACER_H
+#define LAUNCHTRACER_H
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+#include <array>
+
+// Stages of a launch, each is measured from the moment Launch was received.
+enum class LaunchStage : uint8_t {
+    Options,        // options and environments are assembled.
+    Exec,           // the Exec key is expanded.
+    Scheduled,      // the job is scheduled.
+    SplashShown,    // the prelaunch splash is requested.
+    UnitStarted,    // the job of the unit is done, i.e. the process is executed.
+    InstanceAdded,  // the unit is known to application manager as an instance.
+    SplashClosed,   // the prelaunch splash is closed.
+    Count
+};
+
+// Records how long every stage of a launch takes and keeps rolling percentiles of them, over all applications and per
+// application. Every launch is written to the journal once the unit runs as an instance.
+// It's thread safe, a job may complete in the thread pool.
+class LaunchTracer
+{
+public:
+    // of the latest launches which reached a stage, in microseconds since Launch was received.
+    struct Percentiles
+    {
+        // every launch which reached the stage, not only the latest ones.
+        quint64 count{0};
+        qint64 p50{0};
+        qint64 p90{0};
+        qint64 p99{0};
+        qint64 max{0};
+    };
+
+    LaunchTracer() = default;
+    static LaunchTracer &instance() noexcept;
+
+    // microseconds of a monotonic clock.
+    [[nodiscard]] static qint64 now() noexcept;
+    [[nodiscard]] static QString stageName(LaunchStage stage) noexcept;
+
+    void begin(const QString &instanceId, const QString &appId, qint64 receivedAt) noexcept;
+    void mark(const QString &instanceId, LaunchStage stage, qint64 at = now()) noexcept;
+    void fail(const QString &instanceId, const QString &reason) noexcept;
+
+    // stage name -> percentiles, of every application if appId is empty.
+    [[nodiscard]] QMap<QString, Percentiles> statistics(const QString &appId = {}) const noexcept;
+    void reset() noexcept;
+    [[nodiscard]] qsizetype pendingCount() const noexcept;
+
+private:
+    static constexpr auto StageCount = static_cast<std::size_t>(LaunchStage::Count);
+    static constexpr qsizetype MaxTraces = 128;
+    static constexpr qsizetype MaxApplications = 256;
+    static constexpr qsizetype TotalWindow = 1024;
+    static constexpr qsizetype ApplicationWindow = 64;
+
+    // the latest samples of one stage, older ones are overwritten.
+    class Window
+    {
+    public:
+        void add(qint64 sample, qsizetype capacity) noexcept;
+        [[nodiscard]] Percentiles percentiles() const noexcept;
+
+    private:
+        QList<qint64> m_samples;
+        qsizetype m_next{0};
+        quint64 m_count{0};
+    };
+    using StageWindows = std::array<Window, StageCount>;
+
+    struct Trace
+    {
+        QString appId;
+        qint64 receivedAt{0};
+        // microseconds since receivedAt, -1 if the stage isn't reached yet.
+        std::array<qint64, StageCount> stages{};
+        bool logged{false};
+
+        [[nodiscard]] bool has(LaunchStage stage) const noexcept { return stages[static_cast<std::size_t>(stage)] != -1; }
+    };
+
+    void evictOldest() noexcept;
+    static void log(const QString &instanceId, const Trace &trace, QStringView outcome) noexcept;
+
+    mutable QMutex m_mutex;
+    QHash<QString, Trace> m_traces;
+    StageWindows m_total;
+    QHash<QString, StageWindows> m_applications;
+};
+
+#endif
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "mimefileparser.h"
+#include "textkernels.h"
 
 Q_LOGGING_CATEGORY(DDEAMMimeParser, "dde.am.mime.parser")
 
@@ -47,7 +48,7 @@ ParserError MimeFileParser::addGroup(Groups &ret, QString &groupName) noexcept
     // Parsing group header, this format is same as desktop file's group
 
     const auto headerBytes = m_line.sliced(1, m_line.size() - 2).trimmed();
-    if (std::any_of(headerBytes.cbegin(), headerBytes.cend(), [](auto ch) { return ch == '[' || ch == ']'; })) {
+    if (TextKernels::indexOf(headerBytes, '[') != -1 || TextKernels::indexOf(headerBytes, ']') != -1) {
         qCWarning(DDEAMMimeParser) << "group header invalid:" << toUtf8String(m_line);
         return ParserError::InvalidFormat;
     }
@@ -102,7 +103,7 @@ ParserError MimeFileParser::addGroup(Groups &ret, QString &groupName) noexcept
 
 ParserError MimeFileParser::addEntry(Groups::iterator group) noexcept
 {
-    const auto splitCharIndex = m_line.indexOf('=');
+    const auto splitCharIndex = TextKernels::indexOf(m_line, '=');
     if (splitCharIndex == -1) {
         qWarning() << "invalid line in desktop file, skip it:" << toUtf8String(m_line);
         clearLine();
@@ -124,12 +125,19 @@ ParserError MimeFileParser::addEntry(Groups::iterator group) noexcept
         return ParserError::InvalidFormat;
     }
 
-    const auto values = QByteArray{valueView}.split(';');
-    for (const auto &subValue : values) {
-        auto trimmedSubView = QByteArrayView{subValue}.trimmed();
+    qsizetype begin{0};
+    while (begin <= valueView.size()) {
+        auto end = TextKernels::indexOf(valueView, ';', begin);
+        if (end == -1) {
+            end = valueView.size();
+        }
+
+        auto trimmedSubView = valueView.sliced(begin, end - begin).trimmed();
         if (!trimmedSubView.isEmpty()) {
             list.append(toUtf8String(trimmedSubView));
         }
+
+        begin = end + 1;
     }
 
     clearLine();
@@ -11,8 +11,12 @@
 #include <QMetaProperty>
 #include <QMutex>
 #include <QMutexLocker>
+#include <atomic>
 
 namespace {
+std::atomic<quint64> notificationCount{0};
+std::atomic<quint64> messageCount{0};
+
 struct PropertyCacheEntry
 {
     QMetaMethod signal;
@@ -54,6 +58,10 @@ PropertiesForwarder::PropertiesForwarder(QString path, QString interfaceName, QO
     , m_path(std::move(path))
     , m_interfaceName(std::move(interfaceName))
 {
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(0);
+    connect(&m_flushTimer, &QTimer::timeout, this, &PropertiesForwarder::flush);
+
     const auto *mo = parent->metaObject();
 
     if (mo == nullptr) {
@@ -68,12 +76,16 @@ PropertiesForwarder::PropertiesForwarder(QString path, QString interfaceName, QO
     }
 }
 
+PropertiesForwarder::Stats PropertiesForwarder::stats() noexcept
+{
+    return Stats{notificationCount.load(std::memory_order_relaxed), messageCount.load(std::memory_order_relaxed)};
+}
+
 void PropertiesForwarder::PropertyChanged()
 {
-    auto *sender = QObject::sender();
     auto sigIndex = QObject::senderSignalIndex();
 
-    const auto *mo = sender->metaObject();
+    const auto *mo = parent()->metaObject();
     if (mo == nullptr) {
         qCritical() << "PropertiesForwarder::PropertyChanged [relay propertiesChanged failed.]";
         return;
@@ -86,16 +98,48 @@ void PropertiesForwarder::PropertyChanged()
         return;
     }
 
-    const auto &propName = propIt->propertyName;
-    const auto propIndex = mo->indexOfProperty(propName.constData());
-    auto prop = mo->property(propIndex);
-    auto value = prop.read(sender);
+    notificationCount.fetch_add(1, std::memory_order_relaxed);
+
+    // values are read when flushing, so a property which changed several times is only sent once.
+    if (!m_pendingProperties.contains(propIt->propertyName)) {
+        m_pendingProperties.append(propIt->propertyName);
+    }
+
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+std::optional<QDBusMessage> PropertiesForwarder::takePendingMessage() noexcept
+{
+    const auto properties = std::exchange(m_pendingProperties, {});
+    if (properties.isEmpty()) {
+        return std::nullopt;
+    }
+
+    const auto *mo = parent()->metaObject();
+    QVariantMap changed;
+    for (const auto &propName : properties) {
+        const auto prop = mo->property(mo->indexOfProperty(propName.constData()));
+        changed.insert(QString::fromLatin1(propName), prop.read(parent()));
+    }
 
     auto msg = QDBusMessage::createSignal(m_path, fromStaticRaw(SystemdPropInterfaceName), "PropertiesChanged");
 
     msg << m_interfaceName;
-    msg << QVariantMap{{QString{propName}, value}};
+    msg << changed;
     msg << QStringList{};
 
-    ApplicationManager1DBus::instance().globalServerBus().send(msg);
+    return msg;
+}
+
+void PropertiesForwarder::flush() noexcept
+{
+    auto msg = takePendingMessage();
+    if (!msg) {
+        return;
+    }
+
+    messageCount.fetch_add(1, std::memory_order_relaxed);
+    ApplicationManager1DBus::instance().globalServerBus().send(msg.value());
 }
@@ -5,19 +5,46 @@
 #ifndef PROPERTIESFORWARDER_H
 #define PROPERTIESFORWARDER_H
 
+#include <QDBusMessage>
+#include <QList>
 #include <QObject>
+#include <QTimer>
+#include <optional>
 
 class PropertiesForwarder : public QObject
 {
     Q_OBJECT
 public:
+    struct Stats
+    {
+        // notify signals which were forwarded.
+        quint64 notifications{0};
+        // PropertiesChanged messages which were actually sent.
+        quint64 messages{0};
+
+        [[nodiscard]] quint64 saved() const noexcept { return notifications - messages; }
+    };
+
     explicit PropertiesForwarder(QString path, QString interfaceName, QObject *parent);
+
+    // Changes notified within the window are sent as one PropertiesChanged, 0 means the next event loop turn.
+    void setCoalescingWindow(int msec) noexcept { m_flushTimer.setInterval(msec); }
+    [[nodiscard]] int coalescingWindow() const noexcept { return m_flushTimer.interval(); }
+
+    // Counters of all forwarders in this process, exported by GetPropertiesChangedStats of the Debug interface.
+    [[nodiscard]] static Stats stats() noexcept;
+
 public Q_SLOTS:
     void PropertyChanged();
 
 private:
+    void flush() noexcept;
+    [[nodiscard]] std::optional<QDBusMessage> takePendingMessage() noexcept;
+
     QString m_path;
     QString m_interfaceName;
+    QList<QByteArray> m_pendingProperties;
+    QTimer m_flushTimer;
 };
 
 #endif
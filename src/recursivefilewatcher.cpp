@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "recursivefilewatcher.h"
+#include <QDirIterator>
+#include <QFile>
+#include <QLoggingCategory>
+#include <QStringBuilder>
+#include <sys/inotify.h>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+Q_LOGGING_CATEGORY(logFileWatcher, "dde.am.filewatcher")
+
+namespace {
+constexpr uint32_t DirectoryEvents = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB |
+                                     IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+}  // namespace
+
+RecursiveFileWatcher::RecursiveFileWatcher(QObject *parent) noexcept
+    : QObject(parent)
+    , m_fd(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+{
+    if (m_fd == -1) {
+        qCCritical(logFileWatcher) << "inotify_init1 failed:" << std::strerror(errno);
+        return;
+    }
+
+    m_notifier.reset(new (std::nothrow) QSocketNotifier{m_fd, QSocketNotifier::Read});
+    if (!m_notifier) {
+        qCCritical(logFileWatcher) << "new QSocketNotifier failed.";
+        return;
+    }
+
+    connect(m_notifier.get(), &QSocketNotifier::activated, this, &RecursiveFileWatcher::readEvents);
+}
+
+RecursiveFileWatcher::~RecursiveFileWatcher()
+{
+    m_notifier.reset();
+    if (m_fd != -1) {
+        ::close(m_fd);
+    }
+}
+
+bool RecursiveFileWatcher::addRoot(const QString &root) noexcept
+{
+    if (m_fd == -1) {
+        return false;
+    }
+
+    // the root itself may be a symlink, e.g. a distribution linking applications to another prefix.
+    if (!watchDirectory(root, true)) {
+        return false;
+    }
+
+    watchTree(root);
+    return true;
+}
+
+RecursiveFileWatcher::Changes RecursiveFileWatcher::takeChanges() noexcept
+{
+    return std::exchange(m_changes, {});
+}
+
+bool RecursiveFileWatcher::watchDirectory(const QString &path, bool followSymlink) noexcept
+{
+    if (m_watches.contains(path)) {
+        return true;
+    }
+
+    const auto mask = followSymlink ? DirectoryEvents : (DirectoryEvents | IN_DONT_FOLLOW);
+    const auto wd = ::inotify_add_watch(m_fd, QFile::encodeName(path).constData(), mask);
+    if (wd == -1) {
+        qCWarning(logFileWatcher) << "couldn't watch directory" << path << ":" << std::strerror(errno);
+        return false;
+    }
+
+    // moving a watched directory around inside the tree keeps its watch descriptor.
+    if (auto old = m_paths.constFind(wd); old != m_paths.cend()) {
+        m_watches.remove(*old);
+    }
+
+    m_paths.insert(wd, path);
+    m_watches.insert(path, wd);
+    return true;
+}
+
+void RecursiveFileWatcher::watchTree(const QString &path) noexcept
+{
+    // symlinked subdirectories aren't followed, the same as application scanning.
+    QDirIterator it{path, QDir::Dirs | QDir::NoDotAndDotDot | QDir::NoSymLinks, QDirIterator::Subdirectories};
+    while (it.hasNext()) {
+        watchDirectory(it.next(), false);
+    }
+}
+
+void RecursiveFileWatcher::unwatchTree(const QString &path) noexcept
+{
+    const QString prefix = path % u'/';
+    for (auto it = m_watches.begin(); it != m_watches.end();) {
+        if (it.key() != path && !it.key().startsWith(prefix)) {
+            ++it;
+            continue;
+        }
+
+        ::inotify_rm_watch(m_fd, it.value());
+        m_paths.remove(it.value());
+        it = m_watches.erase(it);
+    }
+}
+
+void RecursiveFileWatcher::readEvents() noexcept
+{
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+        const auto len = ::read(m_fd, buffer, sizeof(buffer));
+        if (len == -1 && errno == EINTR) {
+            continue;
+        }
+
+        if (len <= 0) {
+            if (len == -1 && errno != EAGAIN) {
+                qCWarning(logFileWatcher) << "read inotify events failed:" << std::strerror(errno);
+            }
+            break;
+        }
+
+        for (const char *ptr = buffer; ptr < buffer + len;) {
+            const auto *event = reinterpret_cast<const inotify_event *>(ptr);
+            handleEvent(*event);
+            ptr += sizeof(inotify_event) + event->len;
+        }
+    }
+
+    if (!m_changes.isEmpty()) {
+        emit changed();
+    }
+}
+
+void RecursiveFileWatcher::handleEvent(const inotify_event &event) noexcept
+{
+    if ((event.mask & IN_Q_OVERFLOW) != 0) {
+        qCWarning(logFileWatcher) << "inotify queue overflowed, some changes are lost.";
+        m_changes.overflowed = true;
+        return;
+    }
+
+    const auto dirIt = m_paths.constFind(event.wd);
+    if (dirIt == m_paths.cend()) {
+        return;
+    }
+    const auto dir = *dirIt;
+
+    if ((event.mask & IN_IGNORED) != 0) {
+        // the watched directory is gone, or it was unwatched by unwatchTree.
+        m_watches.remove(dir);
+        m_paths.remove(event.wd);
+        return;
+    }
+
+    if ((event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) != 0) {
+        m_changes.directories.insert(dir);
+        if ((event.mask & IN_MOVE_SELF) != 0) {
+            // the kernel keeps watching a moved directory, but its path is stale now.
+            unwatchTree(dir);
+        }
+        return;
+    }
+
+    if (event.len == 0) {
+        return;
+    }
+
+    const QString path = dir % u'/' % QFile::decodeName(event.name);
+    if ((event.mask & IN_ISDIR) == 0) {
+        m_changes.files.insert(path);
+        return;
+    }
+
+    m_changes.directories.insert(path);
+    if ((event.mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+        // files created before the watch was added are covered by reporting the directory itself.
+        if (watchDirectory(path, false)) {
+            watchTree(path);
+        }
+    } else if ((event.mask & (IN_DELETE | IN_MOVED_FROM)) != 0) {
+        unwatchTree(path);
+    }
+}
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef RECURSIVEFILEWATCHER_H
+#define RECURSIVEFILEWATCHER_H
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QSocketNotifier>
+#include <QString>
+#include <memory>
+
+struct inotify_event;
+
+// Watches directory trees with inotify and accumulates the paths which changed below them.
+// Subdirectories are watched as they appear, so the caller only has to look at what changed instead of rescanning.
+class RecursiveFileWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    struct Changes
+    {
+        // files which were created, written, moved or removed.
+        QSet<QString> files;
+        // directories which were created, moved or removed, everything below them may have changed.
+        QSet<QString> directories;
+        // the kernel queue overflowed and events were lost, callers must rescan everything.
+        bool overflowed{false};
+
+        [[nodiscard]] bool isEmpty() const noexcept { return files.isEmpty() && directories.isEmpty() && !overflowed; }
+    };
+
+    explicit RecursiveFileWatcher(QObject *parent = nullptr) noexcept;
+    ~RecursiveFileWatcher() override;
+    RecursiveFileWatcher(const RecursiveFileWatcher &) = delete;
+    RecursiveFileWatcher(RecursiveFileWatcher &&) = delete;
+    RecursiveFileWatcher &operator=(const RecursiveFileWatcher &) = delete;
+    RecursiveFileWatcher &operator=(RecursiveFileWatcher &&) = delete;
+
+    // Watches root and every directory below it, returns false if root couldn't be watched.
+    bool addRoot(const QString &root) noexcept;
+    [[nodiscard]] Changes takeChanges() noexcept;
+    [[nodiscard]] bool isValid() const noexcept { return m_fd != -1; }
+    [[nodiscard]] qsizetype watchCount() const noexcept { return m_paths.size(); }
+
+Q_SIGNALS:
+    void changed();
+
+private:
+    void readEvents() noexcept;
+    void handleEvent(const inotify_event &event) noexcept;
+    bool watchDirectory(const QString &path, bool followSymlink) noexcept;
+    void watchTree(const QString &path) noexcept;
+    void unwatchTree(const QString &path) noexcept;
+
+    int m_fd{-1};
+    std::unique_ptr<QSocketNotifier> m_notifier;
+    QHash<int, QString> m_paths;
+    QHash<QString, int> m_watches;
+    Changes m_changes;
+};
+
+#endif
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "registrysnapshot.h"
+#include "common/registryformat.h"
+#include "global.h"
+#include <QDir>
+#include <QLoggingCategory>
+#include <QSaveFile>
+#include <algorithm>
+#include <cstring>
+
+using namespace Qt::StringLiterals;
+
+Q_LOGGING_CATEGORY(logRegistrySnapshot, "dde.am.registry")
+
+namespace {
+class StringTable
+{
+public:
+    RegistryFormat::StringRef add(const QString &str) noexcept
+    {
+        const auto utf8 = str.toUtf8();
+        const RegistryFormat::StringRef ref{static_cast<uint32_t>(m_data.size()), static_cast<uint32_t>(utf8.size())};
+        m_data.append(utf8);
+        m_data.append('\0');
+        return ref;
+    }
+
+    [[nodiscard]] const QByteArray &data() const noexcept { return m_data; }
+    [[nodiscard]] QByteArrayView view(RegistryFormat::StringRef ref) const noexcept
+    {
+        return QByteArrayView{m_data}.sliced(ref.offset, ref.size);
+    }
+
+private:
+    QByteArray m_data;
+};
+}  // namespace
+
+namespace RegistrySnapshot {
+
+QByteArray serialize(const QList<Application> &applications, quint64 generation, const QString &locale) noexcept
+{
+    StringTable strings;
+    QList<RegistryFormat::Record> records;
+    records.reserve(applications.size());
+    for (const auto &app : applications) {
+        RegistryFormat::Record record{};
+        record.id = strings.add(app.id);
+        record.objectPath = strings.add(app.objectPath);
+        record.name = strings.add(app.name);
+        record.genericName = strings.add(app.genericName);
+        record.icon = strings.add(app.icon);
+        record.categories = strings.add(app.categories.join(u';'));
+        record.exec = strings.add(app.exec);
+        record.flags = (app.noDisplay ? RegistryFormat::NoDisplay : 0U) | (app.terminal ? RegistryFormat::Terminal : 0U);
+        records.append(record);
+    }
+
+    // readers compare IDs as bytes, so they're sorted as UTF-8 instead of UTF-16.
+    std::sort(records.begin(), records.end(), [&strings](const RegistryFormat::Record &lhs, const RegistryFormat::Record &rhs) {
+        return strings.view(lhs.id) < strings.view(rhs.id);
+    });
+
+    RegistryFormat::Header header{};
+    std::memcpy(header.magic, RegistryFormat::Magic, sizeof(header.magic));
+    header.version = RegistryFormat::Version;
+    header.generation = generation;
+    header.recordCount = static_cast<uint32_t>(records.size());
+    header.recordSize = sizeof(RegistryFormat::Record);
+    header.locale = strings.add(locale);
+    header.recordsOffset = sizeof(RegistryFormat::Header);
+    header.stringsOffset = header.recordsOffset + records.size() * sizeof(RegistryFormat::Record);
+    header.stringsSize = strings.data().size();
+
+    QByteArray ret;
+    ret.reserve(static_cast<qsizetype>(header.stringsOffset + header.stringsSize));
+    ret.append(reinterpret_cast<const char *>(&header), sizeof(header));  // NOLINT
+    ret.append(reinterpret_cast<const char *>(records.constData()),       // NOLINT
+               static_cast<qsizetype>(records.size() * sizeof(RegistryFormat::Record)));
+    ret.append(strings.data());
+    return ret;
+}
+
+bool write(const QString &path, const QByteArray &snapshot) noexcept
+{
+    const auto dir = QFileInfo{path}.absoluteDir();
+    if (!dir.exists() && !dir.mkpath(u"."_s)) {
+        qCWarning(logRegistrySnapshot) << "couldn't create directory" << dir.absolutePath();
+        return false;
+    }
+
+    // QSaveFile renames the new file over the old one, mappings of the old one stay intact.
+    QSaveFile out{path};
+    if (!out.open(QIODevice::WriteOnly) || out.write(snapshot) != snapshot.size() || !out.commit()) {
+        qCWarning(logRegistrySnapshot) << "write registry snapshot" << path << "failed:" << out.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+QString defaultPath() noexcept
+{
+    return QDir{getXDGRuntimeDir()}.filePath(QString::fromLatin1(RegistryFormat::FileName));
+}
+
+}  // namespace RegistrySnapshot
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef REGISTRYSNAPSHOT_H
+#define REGISTRYSNAPSHOT_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+// Writes the read-only application registry described in common/registryformat.h.
+namespace RegistrySnapshot {
+
+struct Application
+{
+    QString id;
+    QString objectPath;
+    QString name;
+    QString genericName;
+    QString icon;
+    QStringList categories;
+    QString exec;
+    bool noDisplay{false};
+    bool terminal{false};
+};
+
+// applications are sorted by ID, so readers can look them up by binary search.
+[[nodiscard]] QByteArray serialize(const QList<Application> &applications, quint64 generation, const QString &locale) noexcept;
+// replaces the snapshot at path atomically.
+bool write(const QString &path, const QByteArray &snapshot) noexcept;
+[[nodiscard]] QString defaultPath() noexcept;
+
+}  // namespace RegistrySnapshot
+
+#endif
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "stringinterner.h"
+
+StringInterner &StringInterner::instance() noexcept
+{
+    static StringInterner interner;
+    return interner;
+}
+
+QString StringInterner::intern(QByteArrayView latin1) noexcept
+{
+    // fromRawData doesn't copy, the lookup is allocation free when the string is already interned.
+    const auto key = QByteArray::fromRawData(latin1.data(), latin1.size());
+    {
+        QReadLocker locker{&m_lock};
+        if (auto it = m_strings.constFind(key); it != m_strings.cend()) {
+            return *it;
+        }
+    }
+
+    QWriteLocker locker{&m_lock};
+    if (auto it = m_strings.constFind(key); it != m_strings.cend()) {
+        return *it;
+    }
+
+    auto str = QString::fromLatin1(latin1);
+    m_strings.insert(latin1.toByteArray(), str);
+    return str;
+}
+
+QString StringInterner::intern(QStringView str) noexcept
+{
+    return intern(QByteArrayView{str.toLatin1()});
+}
+
+qsizetype StringInterner::size() const noexcept
+{
+    QReadLocker locker{&m_lock};
+    return m_strings.size();
+}
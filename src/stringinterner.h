@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef STRINGINTERNER_H
+#define STRINGINTERNER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+
+// Process-wide table of shared strings.
+// Group names, keys and locale tags of desktop entries repeat across thousands of files,
+// interning them lets every entry share one implicitly shared buffer instead of allocating its own copy.
+class StringInterner
+{
+public:
+    StringInterner(const StringInterner &) = delete;
+    StringInterner(StringInterner &&) = delete;
+    StringInterner &operator=(const StringInterner &) = delete;
+    StringInterner &operator=(StringInterner &&) = delete;
+    ~StringInterner() = default;
+
+    static StringInterner &instance() noexcept;
+
+    // NOTE: Only for ASCII content like keys and locale tags, callers must validate it before interning.
+    [[nodiscard]] QString intern(QByteArrayView latin1) noexcept;
+    [[nodiscard]] QString intern(QStringView str) noexcept;
+    [[nodiscard]] qsizetype size() const noexcept;
+
+private:
+    StringInterner() = default;
+    mutable QReadWriteLock m_lock;
+    QHash<QByteArray, QString> m_strings;
+};
+
+#endif
@@ -50,6 +50,16 @@ bool SystemdSignalDispatcher::connectToSignals() noexcept
         return false;
     }
 
+    if (!con.connect(SystemdService,
+                     SystemdObjectPath,
+                     SystemdInterfaceName,
+                     u"JobRemoved"_s,
+                     this,
+                     SLOT(onJobRemoved(uint32_t, const QDBusObjectPath &, const QString &, const QString &)))) {
+        qCritical() << "can't connect to JobRemoved signal of systemd service.";
+        return false;
+    }
+
     return true;
 }
 
@@ -83,3 +93,11 @@ void SystemdSignalDispatcher::onUnitRemoved(const QString &unitName, const QDBus
 {
     emit SystemdUnitRemoved(unitName, systemdUnitPath);
 }
+
+void SystemdSignalDispatcher::onJobRemoved([[maybe_unused]] uint32_t id,
+                                           [[maybe_unused]] const QDBusObjectPath &job,
+                                           const QString &unitName,
+                                           const QString &result)
+{
+    emit SystemdJobRemoved(unitName, result);
+}
@@ -21,12 +21,14 @@ Q_SIGNALS:
     void SystemdUnitNew(const QString &unitName, const QDBusObjectPath &systemdUnitPath);
     void SystemdJobNew(const QString &unitName, const QDBusObjectPath &systemdUnitPath);
     void SystemdUnitRemoved(const QString &unitName, const QDBusObjectPath &systemdUnitPath);
+    void SystemdJobRemoved(const QString &unitName, const QString &result);
     void SystemdEnvironmentChanged(const QStringList &envs);
 
 private Q_SLOTS:
     void onUnitNew(const QString &unitName, const QDBusObjectPath &systemdUnitPath);
     void onJobNew(uint32_t id, const QDBusObjectPath &systemdUnitPath, const QString &unitName);
     void onUnitRemoved(const QString &unitName, const QDBusObjectPath &systemdUnitPath);
+    void onJobRemoved(uint32_t id, const QDBusObjectPath &job, const QString &unitName, const QString &result);
     void onPropertiesChanged(const QString &interface, const QVariantMap &props, const QStringList &invalid);
 
 private:
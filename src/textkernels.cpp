@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "textkernels.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define DDE_AM_TEXT_KERNELS_SSE2
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(DDE_AM_TEXT_KERNELS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define DDE_AM_TEXT_KERNELS_AVX2
+#endif
+
+namespace TextKernels {
+
+namespace {
+
+constexpr uint8_t AllCharClasses = NonAscii | Control;
+
+qsizetype shifted(qsizetype base, qsizetype index) noexcept
+{
+    return index == -1 ? -1 : base + index;
+}
+
+// Scalar reference implementations, also used for the tails of the vectorized kernels.
+
+qsizetype indexOfByteScalar(const char *data, qsizetype size, char ch) noexcept
+{
+    for (qsizetype i = 0; i < size; ++i) {
+        if (data[i] == ch) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+qsizetype indexOfInvalidKeyCharScalar(const char *data, qsizetype size) noexcept
+{
+    for (qsizetype i = 0; i < size; ++i) {
+        const auto ch = data[i];
+        if ((ch < 'A' || ch > 'Z') && (ch < 'a' || ch > 'z') && (ch < '0' || ch > '9') && ch != '-') {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+qsizetype indexOfCharScalar(const char16_t *data, qsizetype size, char16_t ch) noexcept
+{
+    for (qsizetype i = 0; i < size; ++i) {
+        if (data[i] == ch) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+uint8_t classifyScalar(const char16_t *data, qsizetype size, uint8_t found = NoSpecialCharacter) noexcept
+{
+    for (qsizetype i = 0; i < size && found != AllCharClasses; ++i) {
+        const auto u = data[i];
+
+        if (u > 127) {
+            found |= NonAscii;
+        }
+
+        if (u <= 31 || (u >= 127 && u <= 159)) {
+            found |= Control;
+        }
+    }
+
+    return found;
+}
+
+uint8_t classifyScalarEntry(const char16_t *data, qsizetype size) noexcept
+{
+    return classifyScalar(data, size);
+}
+
+constexpr Kernels ScalarKernels{indexOfByteScalar, indexOfInvalidKeyCharScalar, indexOfCharScalar, classifyScalarEntry};
+
+#ifdef DDE_AM_TEXT_KERNELS_SSE2
+
+constexpr qsizetype Sse2Width = 16;
+
+qsizetype indexOfByteSse2(const char *data, qsizetype size, char ch) noexcept
+{
+    const auto needle = _mm_set1_epi8(ch);
+    qsizetype i = 0;
+    for (; i + Sse2Width <= size; i += Sse2Width) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return shifted(i, indexOfByteScalar(data + i, size - i, ch));
+}
+
+qsizetype indexOfInvalidKeyCharSse2(const char *data, qsizetype size) noexcept
+{
+    // bytes above 0x7f are negative in the signed comparisons, so they never fall into a valid range.
+    const auto lowerBegin = _mm_set1_epi8('a' - 1);
+    const auto lowerEnd = _mm_set1_epi8('z' + 1);
+    const auto digitBegin = _mm_set1_epi8('0' - 1);
+    const auto digitEnd = _mm_set1_epi8('9' + 1);
+    const auto caseBit = _mm_set1_epi8(0x20);
+    const auto dash = _mm_set1_epi8('-');
+
+    qsizetype i = 0;
+    for (; i + Sse2Width <= size; i += Sse2Width) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        // only letters are folded, folding would turn some control characters into digits or '-'.
+        const auto folded = _mm_or_si128(chunk, caseBit);
+        const auto letter = _mm_and_si128(_mm_cmpgt_epi8(folded, lowerBegin), _mm_cmpgt_epi8(lowerEnd, folded));
+        const auto digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, digitBegin), _mm_cmpgt_epi8(digitEnd, chunk));
+        const auto valid = _mm_or_si128(_mm_or_si128(letter, digit), _mm_cmpeq_epi8(chunk, dash));
+        const auto mask = ~static_cast<unsigned>(_mm_movemask_epi8(valid)) & 0xFFFFU;
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return shifted(i, indexOfInvalidKeyCharScalar(data + i, size - i));
+}
+
+qsizetype indexOfCharSse2(const char16_t *data, qsizetype size, char16_t ch) noexcept
+{
+    constexpr qsizetype width = Sse2Width / sizeof(char16_t);
+    const auto needle = _mm_set1_epi16(static_cast<short>(ch));
+    qsizetype i = 0;
+    for (; i + width <= size; i += width) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        // every code unit sets two bits of the byte mask.
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask) / 2;
+        }
+    }
+
+    return shifted(i, indexOfCharScalar(data + i, size - i, ch));
+}
+
+uint8_t classifySse2(const char16_t *data, qsizetype size) noexcept
+{
+    constexpr qsizetype width = Sse2Width / sizeof(char16_t);
+    const auto zero = _mm_setzero_si128();
+    const auto asciiMax = _mm_set1_epi16(127);
+    const auto c0Max = _mm_set1_epi16(31);
+    const auto c1Begin = _mm_set1_epi16(127);
+    const auto c1Range = _mm_set1_epi16(159 - 127);
+
+    uint8_t found{NoSpecialCharacter};
+    qsizetype i = 0;
+    for (; i + width <= size && found != AllCharClasses; i += width) {
+        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        // unsigned saturating subtraction yields zero iff the code unit is not above the bound.
+        const auto ascii = _mm_cmpeq_epi16(_mm_subs_epu16(chunk, asciiMax), zero);
+        if (_mm_movemask_epi8(ascii) != 0xFFFF) {
+            found |= NonAscii;
+        }
+
+        const auto c0 = _mm_cmpeq_epi16(_mm_subs_epu16(chunk, c0Max), zero);
+        const auto c1 = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(chunk, c1Begin), c1Range), zero);
+        if (_mm_movemask_epi8(_mm_or_si128(c0, c1)) != 0) {
+            found |= Control;
+        }
+    }
+
+    return i < size ? classifyScalar(data + i, size - i, found) : found;
+}
+
+constexpr Kernels Sse2Kernels{indexOfByteSse2, indexOfInvalidKeyCharSse2, indexOfCharSse2, classifySse2};
+
+#endif
+
+#ifdef DDE_AM_TEXT_KERNELS_AVX2
+
+constexpr qsizetype Avx2Width = 32;
+
+__attribute__((target("avx2"))) qsizetype indexOfByteAvx2(const char *data, qsizetype size, char ch) noexcept
+{
+    const auto needle = _mm256_set1_epi8(ch);
+    qsizetype i = 0;
+    for (; i + Avx2Width <= size; i += Avx2Width) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return shifted(i, indexOfByteSse2(data + i, size - i, ch));
+}
+
+__attribute__((target("avx2"))) qsizetype indexOfInvalidKeyCharAvx2(const char *data, qsizetype size) noexcept
+{
+    const auto lowerBegin = _mm256_set1_epi8('a' - 1);
+    const auto lowerEnd = _mm256_set1_epi8('z' + 1);
+    const auto digitBegin = _mm256_set1_epi8('0' - 1);
+    const auto digitEnd = _mm256_set1_epi8('9' + 1);
+    const auto caseBit = _mm256_set1_epi8(0x20);
+    const auto dash = _mm256_set1_epi8('-');
+
+    qsizetype i = 0;
+    for (; i + Avx2Width <= size; i += Avx2Width) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const auto folded = _mm256_or_si256(chunk, caseBit);
+        const auto letter = _mm256_and_si256(_mm256_cmpgt_epi8(folded, lowerBegin), _mm256_cmpgt_epi8(lowerEnd, folded));
+        const auto digit = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, digitBegin), _mm256_cmpgt_epi8(digitEnd, chunk));
+        const auto valid = _mm256_or_si256(_mm256_or_si256(letter, digit), _mm256_cmpeq_epi8(chunk, dash));
+        const auto mask = ~static_cast<unsigned>(_mm256_movemask_epi8(valid));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return shifted(i, indexOfInvalidKeyCharSse2(data + i, size - i));
+}
+
+__attribute__((target("avx2"))) qsizetype indexOfCharAvx2(const char16_t *data, qsizetype size, char16_t ch) noexcept
+{
+    constexpr qsizetype width = Avx2Width / sizeof(char16_t);
+    const auto needle = _mm256_set1_epi16(static_cast<short>(ch));
+    qsizetype i = 0;
+    for (; i + width <= size; i += width) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(chunk, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask) / 2;
+        }
+    }
+
+    return shifted(i, indexOfCharSse2(data + i, size - i, ch));
+}
+
+__attribute__((target("avx2"))) uint8_t classifyAvx2(const char16_t *data, qsizetype size) noexcept
+{
+    constexpr qsizetype width = Avx2Width / sizeof(char16_t);
+    const auto zero = _mm256_setzero_si256();
+    const auto asciiMax = _mm256_set1_epi16(127);
+    const auto c0Max = _mm256_set1_epi16(31);
+    const auto c1Begin = _mm256_set1_epi16(127);
+    const auto c1Range = _mm256_set1_epi16(159 - 127);
+
+    uint8_t found{NoSpecialCharacter};
+    qsizetype i = 0;
+    for (; i + width <= size && found != AllCharClasses; i += width) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        const auto ascii = _mm256_cmpeq_epi16(_mm256_subs_epu16(chunk, asciiMax), zero);
+        if (static_cast<unsigned>(_mm256_movemask_epi8(ascii)) != 0xFFFFFFFFU) {
+            found |= NonAscii;
+        }
+
+        const auto c0 = _mm256_cmpeq_epi16(_mm256_subs_epu16(chunk, c0Max), zero);
+        const auto c1 = _mm256_cmpeq_epi16(_mm256_subs_epu16(_mm256_sub_epi16(chunk, c1Begin), c1Range), zero);
+        if (_mm256_movemask_epi8(_mm256_or_si256(c0, c1)) != 0) {
+            found |= Control;
+        }
+    }
+
+    return i < size ? classifyScalar(data + i, size - i, found) : found;
+}
+
+constexpr Kernels Avx2Kernels{indexOfByteAvx2, indexOfInvalidKeyCharAvx2, indexOfCharAvx2, classifyAvx2};
+
+#endif
+
+}  // namespace
+
+bool isSupported(Isa isa) noexcept
+{
+    switch (isa) {
+    case Isa::Scalar:
+        return true;
+    case Isa::SSE2:
+#ifdef DDE_AM_TEXT_KERNELS_SSE2
+        return true;
+#else
+        return false;
+#endif
+    case Isa::AVX2:
+#ifdef DDE_AM_TEXT_KERNELS_AVX2
+        return __builtin_cpu_supports("avx2") != 0;
+#else
+        return false;
+#endif
+    }
+
+    return false;
+}
+
+Isa preferredIsa() noexcept
+{
+    static const Isa isa = [] {
+        if (isSupported(Isa::AVX2)) {
+            return Isa::AVX2;
+        }
+        if (isSupported(Isa::SSE2)) {
+            return Isa::SSE2;
+        }
+        return Isa::Scalar;
+    }();
+
+    return isa;
+}
+
+const Kernels &kernels(Isa isa) noexcept
+{
+    switch (isa) {
+    case Isa::Scalar:
+        break;
+    case Isa::SSE2:
+#ifdef DDE_AM_TEXT_KERNELS_SSE2
+        return Sse2Kernels;
+#else
+        break;
+#endif
+    case Isa::AVX2:
+#ifdef DDE_AM_TEXT_KERNELS_AVX2
+        return Avx2Kernels;
+#else
+        break;
+#endif
+    }
+
+    return ScalarKernels;
+}
+
+const Kernels &kernels() noexcept
+{
+    static const Kernels &selected = kernels(preferredIsa());
+    return selected;
+}
+
+}  // namespace TextKernels
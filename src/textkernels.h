@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef TEXTKERNELS_H
+#define TEXTKERNELS_H
+
+#include <QByteArrayView>
+#include <QStringView>
+#include <cstdint>
+
+// Scanning primitives used by the ini style parsers and the desktop entry value helpers.
+// Every kernel has a scalar reference implementation, x86 builds additionally provide SSE2 and AVX2
+// variants, the best one supported by the running CPU is selected once at first use.
+namespace TextKernels {
+
+enum class Isa : uint8_t { Scalar, SSE2, AVX2 };
+
+enum CharClass : uint8_t { NoSpecialCharacter = 0, NonAscii = 1 << 0, Control = 1 << 1 };
+
+struct Kernels
+{
+    // returns the index of the first byte equal to ch, or -1.
+    qsizetype (*indexOfByte)(const char *data, qsizetype size, char ch) noexcept;
+    // returns the index of the first byte which isn't one of [A-Za-z0-9-], or -1.
+    qsizetype (*indexOfInvalidKeyChar)(const char *data, qsizetype size) noexcept;
+    // returns the index of the first UTF-16 code unit equal to ch, or -1.
+    qsizetype (*indexOfChar)(const char16_t *data, qsizetype size, char16_t ch) noexcept;
+    // returns the CharClass flags of all code units, stops early once every flag is set.
+    uint8_t (*classify)(const char16_t *data, qsizetype size) noexcept;
+};
+
+[[nodiscard]] bool isSupported(Isa isa) noexcept;
+[[nodiscard]] Isa preferredIsa() noexcept;
+// NOTE: isa must be supported by the running CPU.
+[[nodiscard]] const Kernels &kernels(Isa isa) noexcept;
+[[nodiscard]] const Kernels &kernels() noexcept;
+
+inline qsizetype indexOf(QByteArrayView data, char ch, qsizetype from = 0) noexcept
+{
+    if (from >= data.size()) {
+        return -1;
+    }
+
+    const auto index = kernels().indexOfByte(data.data() + from, data.size() - from, ch);
+    return index == -1 ? -1 : from + index;
+}
+
+inline qsizetype indexOf(QStringView str, char16_t ch, qsizetype from = 0) noexcept
+{
+    if (from >= str.size()) {
+        return -1;
+    }
+
+    const auto index = kernels().indexOfChar(str.utf16() + from, str.size() - from, ch);
+    return index == -1 ? -1 : from + index;
+}
+
+inline bool isValidKey(QByteArrayView key) noexcept
+{
+    return kernels().indexOfInvalidKeyChar(key.data(), key.size()) == -1;
+}
+
+inline uint8_t classify(QStringView str) noexcept
+{
+    return kernels().classify(str.utf16(), str.size());
+}
+
+}  // namespace TextKernels
+
+#endif
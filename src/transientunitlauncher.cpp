@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "transientunitlauncher.h"
+#include "systemdsignaldispatcher.h"
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QDir>
+#include <QLoggingCategory>
+
+Q_LOGGING_CATEGORY(logLauncher, "dde.am.launcher")
+
+namespace {
+using namespace Qt::StringLiterals;
+
+bool isStringListProperty(QStringView key) noexcept
+{
+    return key == u"Environment" || key == u"UnsetEnvironment" || key == u"ExecSearchPath";
+}
+}  // namespace
+
+TransientUnitLauncher::TransientUnitLauncher(QObject *parent) noexcept
+    : QObject(parent)
+{
+    connect(&SystemdSignalDispatcher::instance(),
+            &SystemdSignalDispatcher::SystemdJobRemoved,
+            this,
+            &TransientUnitLauncher::finish);
+}
+
+TransientUnitLauncher::~TransientUnitLauncher()
+{
+    for (auto &[unitName, promise] : m_pending) {
+        promise.addResult(u"canceled"_s);
+        promise.finish();
+    }
+}
+
+QString TransientUnitLauncher::encodeArgument(const QString &arg) noexcept
+{
+    // see encodeArgument of app-launch-helper for the escape rules.
+    if (arg == u";") {
+        return uR"(\;)"_s;
+    }
+
+    if (!arg.contains(u'$')) {
+        return arg;
+    }
+
+    auto ret = arg;
+    ret.replace(u"$"_s, u"$$"_s);
+    return ret;
+}
+
+std::optional<TransientUnitLauncher::Request> TransientUnitLauncher::parseCommandLine(const QStringList &commandLine) noexcept
+{
+    Request request;
+    QString syslogIdentifier;
+    QStringList keys;
+    QHash<QString, QStringList> values;
+
+    qsizetype cursor{0};
+    const auto total = commandLine.size();
+    while (cursor < total) {
+        const auto &str = commandLine[cursor];
+        if (str == u"--") {
+            ++cursor;
+            break;
+        }
+
+        if (str.size() < 3 || !str.startsWith(u"--")) {
+            qCWarning(logLauncher) << "Unknown option:" << str;
+            return std::nullopt;
+        }
+
+        ++cursor;
+        const auto kvStr = QStringView{str}.mid(2);
+        const auto eqPos = kvStr.indexOf(u'=');
+        if (eqPos <= 0) {
+            qCWarning(logLauncher) << "invalid k-v pair:" << str;
+            return std::nullopt;
+        }
+
+        const auto key = kvStr.first(eqPos).toString();
+        auto value = kvStr.sliced(eqPos + 1).toString();
+        if (key == u"Type") {
+            // the type of service must be exec, it's set below.
+            qCWarning(logLauncher) << "Type should not be configured in command line arguments.";
+            continue;
+        }
+
+        if (key == u"unitName") {
+            request.unitName = value;
+            continue;
+        }
+
+        if (key == u"SyslogIdentifier") {
+            syslogIdentifier = value;
+            continue;
+        }
+
+        if (key == u"ExecSearchPath") {
+            if (!QDir::isAbsolutePath(value)) {
+                qCWarning(logLauncher) << "ExecSearchPath ignoring relative path:" << value;
+                continue;
+            }
+            value = QDir::cleanPath(value);
+        }
+
+        auto &list = values[key];
+        if (list.isEmpty()) {
+            keys.append(key);
+        }
+        list.append(std::move(value));
+    }
+
+    if (request.unitName.isEmpty() || cursor >= total) {
+        qCWarning(logLauncher) << "Missing unitName or execution arguments.";
+        return std::nullopt;
+    }
+
+    auto &props = request.properties;
+    props.reserve(keys.size() + 6);
+    props.append({u"Type"_s, QDBusVariant{u"exec"_s}});
+    props.append({u"ExitType"_s, QDBusVariant{u"cgroup"_s}});
+    props.append({u"Slice"_s, QDBusVariant{u"app.slice"_s}});
+    props.append({u"CollectMode"_s, QDBusVariant{u"inactive-or-failed"_s}});
+    if (!syslogIdentifier.isEmpty()) {
+        props.append({u"SyslogIdentifier"_s, QDBusVariant{syslogIdentifier}});
+    }
+
+    for (const auto &key : std::as_const(keys)) {
+        const auto &list = values[key];
+        if (isStringListProperty(key)) {
+            props.append({key, QDBusVariant{list}});
+        } else {
+            // a string property can't hold more than one value, the last one wins.
+            props.append({key, QDBusVariant{list.constLast()}});
+        }
+    }
+
+    SystemdExecCommand exec;
+    exec.path = encodeArgument(commandLine[cursor]);
+    exec.args.reserve(total - cursor);
+    for (auto i = cursor; i < total; ++i) {
+        exec.args.append(encodeArgument(commandLine[i]));
+    }
+    exec.unclean = false;
+    props.append({u"ExecStart"_s, QDBusVariant{QVariant::fromValue(QList<SystemdExecCommand>{exec})}});
+
+    return request;
+}
+
+QFuture<QString> TransientUnitLauncher::launch(const QStringList &commandLine) noexcept
+{
+    auto request = parseCommandLine(commandLine);
+    if (!request) {
+        return finishedLaunch(u"invalidInput"_s);
+    }
+
+    const auto unitName = request->unitName;
+    if (m_pending.find(unitName) != m_pending.end()) {
+        qCWarning(logLauncher) << "unit" << unitName << "is being started already.";
+        return finishedLaunch(u"invalidInput"_s);
+    }
+
+    auto msg = QDBusMessage::createMethodCall(QString::fromUtf8(SystemdService),
+                                              QString::fromUtf8(SystemdObjectPath),
+                                              QString::fromUtf8(SystemdInterfaceName),
+                                              u"StartTransientUnit"_s);
+    msg.setArguments({unitName,
+                      u"replace"_s,
+                      QVariant::fromValue(std::move(request->properties)),
+                      QVariant::fromValue(QList<SystemdAux>{})});
+
+    // registered before the call is sent, JobRemoved is matched by the unit name like app-launch-helper does.
+    auto &promise = m_pending[unitName];
+    auto future = promise.future();
+    promise.start();
+
+    auto *watcher = new (std::nothrow)
+        QDBusPendingCallWatcher{ApplicationManager1DBus::instance().globalDestBus().asyncCall(msg), this};
+    if (watcher == nullptr) {
+        qCCritical(logLauncher) << "new QDBusPendingCallWatcher failed.";
+        finish(unitName, u"failed"_s);
+        return future;
+    }
+
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, unitName](QDBusPendingCallWatcher *self) {
+        const QDBusPendingReply<QDBusObjectPath> reply = *self;
+        if (reply.isError()) {
+            qCWarning(logLauncher) << "StartTransientUnit" << unitName << "failed:" << reply.error().message();
+            finish(unitName, u"failed"_s);
+        } else {
+            qCDebug(logLauncher) << "unit" << unitName << "is started by job" << reply.value().path();
+        }
+        self->deleteLater();
+    });
+
+    return future;
+}
+
+void TransientUnitLauncher::finish(const QString &unitName, const QString &result) noexcept
+{
+    auto it = m_pending.find(unitName);
+    if (it == m_pending.end()) {
+        return;
+    }
+
+    auto promise = std::move(it->second);
+    m_pending.erase(it);
+    promise.addResult(result);
+    promise.finish();
+}
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef TRANSIENTUNITLAUNCHER_H
+#define TRANSIENTUNITLAUNCHER_H
+
+#include "global.h"
+#include "unitlauncher.h"
+#include <QObject>
+#include <QPromise>
+#include <optional>
+#include <unordered_map>
+
+// Starts the transient units of applications from the daemon itself instead of running app-launch-helper.
+// It accepts the same command line as app-launch-helper and builds the same StartTransientUnit call,
+// but the call is sent asynchronously on the existing connection to systemd and the launch completes
+// when systemd removes the job of the unit, so no process is forked and no thread waits for systemd.
+class TransientUnitLauncher : public QObject, public UnitLauncher
+{
+    Q_OBJECT
+public:
+    struct Request
+    {
+        QString unitName;
+        QList<SystemdProperty> properties;
+    };
+
+    explicit TransientUnitLauncher(QObject *parent = nullptr) noexcept;
+    ~TransientUnitLauncher() override;
+    TransientUnitLauncher(const TransientUnitLauncher &) = delete;
+    TransientUnitLauncher(TransientUnitLauncher &&) = delete;
+    TransientUnitLauncher &operator=(const TransientUnitLauncher &) = delete;
+    TransientUnitLauncher &operator=(TransientUnitLauncher &&) = delete;
+
+    [[nodiscard]] QFuture<QString> launch(const QStringList &commandLine) noexcept override;
+
+    // Parses the command line of app-launch-helper: "--Key=Value" options, "--", then the binary and its arguments.
+    // std::nullopt if it's invalid.
+    [[nodiscard]] static std::optional<Request> parseCommandLine(const QStringList &commandLine) noexcept;
+    // Escapes arg for ExecStart, the same as app-launch-helper.
+    [[nodiscard]] static QString encodeArgument(const QString &arg) noexcept;
+
+private:
+    void finish(const QString &unitName, const QString &result) noexcept;
+
+    std::unordered_map<QString, QPromise<QString>> m_pending;
+};
+
+#endif
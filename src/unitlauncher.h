@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef UNITLAUNCHER_H
+#define UNITLAUNCHER_H
+
+#include <QFuture>
+#include <QPromise>
+#include <QString>
+#include <QStringList>
+
+// Starts transient units of applications without blocking the caller.
+class UnitLauncher
+{
+public:
+    virtual ~UnitLauncher() = default;
+    // commandLine is the command line of app-launch-helper. The future holds the result of the job of the unit,
+    // "done" on success, "invalidInput" if commandLine is rejected, otherwise the failure reported by systemd.
+    [[nodiscard]] virtual QFuture<QString> launch(const QStringList &commandLine) noexcept = 0;
+
+protected:
+    // a future which already holds result, for launches which fail before reaching systemd.
+    [[nodiscard]] static QFuture<QString> finishedLaunch(const QString &result) noexcept
+    {
+        QPromise<QString> promise;
+        auto future = promise.future();
+        promise.start();
+        promise.addResult(result);
+        promise.finish();
+        return future;
+    }
+};
+
+#endif
@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
+#include "changejournal.h"
 #include "global.h"
 #include <gtest/gtest.h>
 #include <QCoreApplication>
@@ -19,6 +20,8 @@ void registerComplexDbusType()  // FIXME: test shouldn't associate with DBus
     qRegisterMetaType<PropMap>();
     qDBusRegisterMetaType<PropMap>();
     qDBusRegisterMetaType<QDBusObjectPath>();
+    qDBusRegisterMetaType<ObjectChange>();
+    qDBusRegisterMetaType<ObjectChangeList>();
 }
 }  // namespace
 
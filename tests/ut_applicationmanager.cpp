@@ -9,13 +9,18 @@
 #include <QProcess>
 #include <thread>
 #include <QDBusUnixFileDescriptor>
+#include <QTemporaryDir>
+#include <QDateTime>
+#include <QFileInfo>
 
+#include "applicationadaptor.h"
 #include "dbus/applicationmanager1service.h"
 #include "dbus/applicationservice.h"
 #include "cgroupsidentifier.h"
 #include "constant.h"
 #include "dbus/instanceadaptor.h"
 #include "global.h"
+#include "utils.h"
 
 class TestApplicationManager : public testing::Test
 {
@@ -168,3 +173,324 @@ TEST_F(TestApplicationManager, identifyService)
         pidFile.remove();
     }
 }
+
+TEST_F(ApplicationManagerTest, managedObjectsCache)
+{
+    auto app = addApplication("cache-test", "[Desktop Entry]\nType=Application\nName=Cache Test\nExec=cache-test\n");
+    ASSERT_FALSE(app.isNull());
+    m_am.watchManagedObject(app.data());
+
+    const auto first = m_am.GetManagedObjects();
+    EXPECT_EQ(first.size(), 1);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().misses, 1);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().hits, 0);
+
+    EXPECT_EQ(m_am.GetManagedObjects(), first);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().misses, 1);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().hits, 1);
+
+    // a NOTIFY signal marks the application dirty, only it is rebuilt.
+    emit app->nameChanged();
+    EXPECT_EQ(m_am.GetManagedObjects(), first);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().misses, 2);
+
+    m_am.invalidateManagedObject(app->id());
+    std::ignore = m_am.GetManagedObjects();
+    EXPECT_EQ(m_am.managedObjectsCacheStats().misses, 3);
+    EXPECT_EQ(m_am.managedObjectsCacheStats().hits, 1);
+    const auto exported = m_am.GetManagedObjectsCacheStats();
+    EXPECT_EQ(exported.value("hits").toULongLong(), 1U);
+    EXPECT_EQ(exported.value("misses").toULongLong(), 3U);
+
+    // X_Deepin_Vendor has no NOTIFY signal, a changed entry still drops the cached object.
+    const auto path = desktopFilePath("cache-test");
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Cache Test\nExec=cache-test\nX-Deepin-Vendor=deepin\n"));
+    auto entry = parseEntry(path);
+    ASSERT_NE(entry, nullptr);
+    app->resetEntry(entry.release());
+
+    const auto vendor = m_am.GetManagedObjects();
+    EXPECT_EQ(m_am.managedObjectsCacheStats().misses, 4);
+    const auto properties = vendor.value(app->applicationPath()).value(fromStaticRaw(ApplicationInterface));
+    EXPECT_EQ(properties.value("X_Deepin_Vendor").toString(), QString{"deepin"});
+}
+
+TEST_F(ApplicationManagerTest, listApplications)
+{
+    const QList<std::pair<QString, QByteArray>> apps{
+        {"list-a", "[Desktop Entry]\nType=Application\nName=A\nExec=a\nCategories=Development;\n"},
+        {"list-b", "[Desktop Entry]\nType=Application\nName=B\nExec=b\nCategories=Utility;\n"},
+        {"list-c", "[Desktop Entry]\nType=Application\nName=C\nExec=c\nCategories=Development;Utility;\n"},
+    };
+    for (const auto &[appId, content] : apps) {
+        ASSERT_FALSE(addApplication(appId, content).isNull());
+    }
+
+    uint total{0};
+    auto ret = m_am.ListApplications({}, {}, 0, 0, total);
+    EXPECT_EQ(total, 3);
+    EXPECT_EQ(ret.keys(), (QStringList{"list-a", "list-b", "list-c"}));
+    EXPECT_TRUE(ret.value("list-a").isEmpty());
+
+    ret = m_am.ListApplications({"ID", "Categories"}, {{"Categories", "Development"}}, 0, 0, total);
+    EXPECT_EQ(total, 2);
+    EXPECT_EQ(ret.keys(), (QStringList{"list-a", "list-c"}));
+    EXPECT_EQ(ret.value("list-c").value("ID").toString(), QString{"list-c"});
+    EXPECT_EQ(ret.value("list-c").value("Categories").toStringList(), (QStringList{"Development", "Utility"}));
+
+    ret = m_am.ListApplications({"ID"}, {{"NoDisplay", false}}, 1, 1, total);
+    EXPECT_EQ(total, 3);
+    EXPECT_EQ(ret.keys(), QStringList{"list-b"});
+
+    ret = m_am.ListApplications({"NoSuchProperty"}, {}, 0, 0, total);
+    EXPECT_TRUE(ret.isEmpty());
+}
+
+TEST_F(ApplicationManagerTest, resetEntryEmitsChangedOnly)
+{
+    auto app = addApplication("reset-test", "[Desktop Entry]\nType=Application\nName=Reset Test\nExec=reset-test\n");
+    ASSERT_FALSE(app.isNull());
+
+    QStringList emitted;
+    const QList<std::pair<QString, void (ApplicationService::*)()>> notifySignals{
+        {"AutoStart", &ApplicationService::autostartChanged},
+        {"NoDisplay", &ApplicationService::noDisplayChanged},
+        {"isOnDesktop", &ApplicationService::isOnDesktopChanged},
+        {"InstalledTime", &ApplicationService::installedTimeChanged},
+        {"Instances", &ApplicationService::instanceChanged},
+        {"LastLaunchedTime", &ApplicationService::lastLaunchedTimeChanged},
+        {"Icons", &ApplicationService::iconsChanged},
+        {"Name", &ApplicationService::nameChanged},
+        {"GenericName", &ApplicationService::genericNameChanged},
+        {"Actions", &ApplicationService::actionsChanged},
+        {"Categories", &ApplicationService::categoriesChanged},
+        {"MimeTypes", &ApplicationService::MimeTypesChanged},
+        {"Environ", &ApplicationService::environChanged},
+        {"LaunchedTimes", &ApplicationService::launchedTimesChanged},
+        {"Execs", &ApplicationService::execsChanged},
+        {"DesktopSourcePath", &ApplicationService::desktopSourcePathChanged},
+    };
+    for (const auto &[name, signal] : notifySignals) {
+        QObject::connect(app.data(), signal, &m_am, [&emitted, name = name] { emitted.append(name); });
+    }
+
+    // a comment isn't exposed, nothing is announced.
+    const auto path = desktopFilePath("reset-test");
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Reset Test\nComment=Changed\nExec=reset-test\n"));
+    app->resetEntry(parseEntry(path).release());
+    EXPECT_TRUE(emitted.isEmpty()) << emitted.join(',').toStdString();
+
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Renamed\nExec=reset-test\nMimeType=text/plain;\n"));
+    app->resetEntry(parseEntry(path).release());
+    emitted.sort();
+    EXPECT_EQ(emitted, (QStringList{"MimeTypes", "Name"}));
+}
+
+TEST_F(ApplicationManagerTest, resetEntryJournalsDiff)
+{
+    m_am.m_startupPhase = false;
+    auto app = addApplication("journal-test", "[Desktop Entry]\nType=Application\nName=Journal Test\nExec=journal-test\n");
+    ASSERT_FALSE(app.isNull());
+    m_am.watchManagedObject(app.data());
+    const auto since = m_am.changeJournal().sequence();
+
+    // X_Deepin_Vendor has no NOTIFY signal, it's journaled from the diff together with Name.
+    const auto path = desktopFilePath("journal-test");
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Renamed\nExec=journal-test\nX-Deepin-Vendor=deepin\n"));
+    auto entry = parseEntry(path);
+    ASSERT_NE(entry, nullptr);
+    app->resetEntry(entry.release());
+
+    const auto changes = m_am.changeJournal().changesSince(since);
+    ASSERT_TRUE(changes.has_value());
+    ASSERT_EQ(changes->size(), 1);
+    EXPECT_EQ(changes->constFirst().kind, ObjectChange::PropertiesChanged);
+    EXPECT_EQ(changes->constFirst().object, app->applicationPath());
+    EXPECT_EQ(changes->constFirst().properties, (QStringList{"Name", "X_Deepin_Vendor"}));
+
+    // other notifications are still journaled, folded into the change of the same object.
+    emit app->environChanged();
+    const auto environ = m_am.changeJournal().changesSince(since);
+    ASSERT_TRUE(environ.has_value());
+    ASSERT_EQ(environ->size(), 1);
+    EXPECT_EQ(environ->constFirst().properties, (QStringList{"Name", "X_Deepin_Vendor", "Environ"}));
+}
+
+TEST_F(ApplicationManagerTest, typedInterfacesMatchAdaptor)
+{
+    auto app = addApplication("typed-test",
+                              "[Desktop Entry]\nType=Application\nName=Typed Test\nName[zh_CN]=类型测试\nExec=typed-test %U\n"
+                              "Icon=typed-test\nCategories=Utility;\nActions=new;\n\n"
+                              "[Desktop Action new]\nName=New Window\nExec=typed-test --new\n");
+    ASSERT_FALSE(app.isNull());
+    new ApplicationAdaptor{app.data()};
+
+    const auto reflected = getChildInterfacesAndPropertiesFromObject(app.data());
+    const auto typed = app->interfacesAndProperties();
+    ASSERT_TRUE(typed.contains(fromStaticRaw(ApplicationInterface)));
+    EXPECT_EQ(typed.keys(), reflected.keys());
+
+    const auto &reflectedProperties = reflected.value(fromStaticRaw(ApplicationInterface));
+    const auto &typedProperties = typed.value(fromStaticRaw(ApplicationInterface));
+    EXPECT_EQ(typedProperties.keys(), reflectedProperties.keys());
+    for (auto it = reflectedProperties.cbegin(); it != reflectedProperties.cend(); ++it) {
+        EXPECT_EQ(typedProperties.value(it.key()).metaType(), it->metaType()) << it.key().toStdString();
+        EXPECT_EQ(typedProperties.value(it.key()), it.value()) << it.key().toStdString();
+    }
+}
+
+TEST_F(ApplicationManagerTest, batchedApplicationsChanged)
+{
+    if (!hasSessionBus()) {
+        GTEST_SKIP() << "ApplicationsChanged is sent on the session bus.";
+    }
+
+    m_am.m_batchedSignals = true;
+    ASSERT_FALSE(addApplication("delta-a", "[Desktop Entry]\nType=Application\nName=A\nExec=a\n").isNull());
+
+    int listChanged{0};
+    int objectSignals{0};
+    QList<QStringList> delta;
+    QObject::connect(&m_am, &ApplicationManager1Service::listChanged, &m_am, [&listChanged] { ++listChanged; });
+    QObject::connect(&m_am, &ApplicationManager1Service::InterfacesAdded, &m_am, [&objectSignals] { ++objectSignals; });
+    QObject::connect(&m_am, &ApplicationManager1Service::InterfacesRemoved, &m_am, [&objectSignals] { ++objectSignals; });
+    QObject::connect(&m_am,
+                     &ApplicationManager1Service::ApplicationsChanged,
+                     &m_am,
+                     [&delta](const QStringList &added, const QStringList &removed, const QStringList &updated) {
+                         delta = {added, removed, updated};
+                     });
+
+    ASSERT_TRUE(writeFile(desktopFilePath("delta-a"), "[Desktop Entry]\nType=Application\nName=Renamed A\nExec=a\n"));
+    ASSERT_TRUE(writeFile(desktopFilePath("delta-b"), "[Desktop Entry]\nType=Application\nName=B\nExec=b\n"));
+    ASSERT_TRUE(writeFile(desktopFilePath("delta-c"), "[Desktop Entry]\nType=Application\nName=C\nExec=c\n"));
+    reload();
+
+    EXPECT_EQ(delta, (QList<QStringList>{{"delta-b", "delta-c"}, {}, {"delta-a"}}));
+    EXPECT_EQ(listChanged, 1);
+    EXPECT_EQ(objectSignals, 0);
+
+    ASSERT_TRUE(QFile::remove(desktopFilePath("delta-c")));
+    delta.clear();
+    reload();
+
+    EXPECT_EQ(delta, (QList<QStringList>{{}, {"delta-c"}, {}}));
+    EXPECT_EQ(listChanged, 2);
+    EXPECT_EQ(objectSignals, 0);
+
+    // nothing changed, nothing is announced.
+    delta.clear();
+    reload();
+    EXPECT_TRUE(delta.isEmpty());
+    EXPECT_EQ(listChanged, 2);
+}
+
+TEST_F(ApplicationManagerTest, localizedProperties)
+{
+    auto app = addApplication("localized-test",
+                              "[Desktop Entry]\nType=Application\nName=Editor\nName[zh_CN]=编辑器\nName[de]=Bearbeiter\n"
+                              "GenericName=Text\\sEditor\nExec=editor\nActions=new;\n\n"
+                              "[Desktop Action new]\nName=New Window\nName[zh_CN]=新窗口\nExec=editor --new\n");
+    ASSERT_FALSE(app.isNull());
+
+    auto zh = app->GetLocalizedProperties("zh_CN");
+    EXPECT_EQ(zh.value("Name").toString(), QString{"编辑器"});
+    EXPECT_EQ(zh.value("GenericName").toString(), QString{"Text Editor"});
+    EXPECT_EQ(zh.value("ActionName").value<QStringMap>(), (QStringMap{{"new", "新窗口"}}));
+
+    // lang_COUNTRY falls back to lang, then to the untranslated value.
+    EXPECT_EQ(app->GetLocalizedProperties("de_AT").value("Name").toString(), QString{"Bearbeiter"});
+    const auto fr = app->GetLocalizedProperties("fr_FR");
+    EXPECT_EQ(fr.value("Name").toString(), QString{"Editor"});
+    EXPECT_EQ(fr.value("ActionName").value<QStringMap>(), (QStringMap{{"new", "New Window"}}));
+    EXPECT_EQ(app->m_localizedProperties.size(), 3);
+
+    const auto all = m_am.GetLocalizedProperties({}, "zh_CN");
+    EXPECT_EQ(all.keys(), QStringList{"localized-test"});
+    EXPECT_EQ(all.value("localized-test"), zh);
+    EXPECT_TRUE(m_am.GetLocalizedProperties({"no-such-app"}, "zh_CN").isEmpty());
+
+    // a changed entry drops the cached translations.
+    const auto path = desktopFilePath("localized-test");
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Editor\nName[zh_CN]=文本编辑器\nExec=editor\n"));
+    auto entry = parseEntry(path);
+    ASSERT_NE(entry, nullptr);
+    app->resetEntry(entry.release());
+
+    zh = app->GetLocalizedProperties("zh_CN");
+    EXPECT_EQ(zh.value("Name").toString(), QString{"文本编辑器"});
+    EXPECT_TRUE(zh.value("ActionName").value<QStringMap>().isEmpty());
+    EXPECT_EQ(app->m_localizedProperties.size(), 1);
+}
+
+TEST_F(ApplicationManagerTest, unchangedAutostartEntryIsNotRewritten)
+{
+    QTemporaryDir autostartDir;
+    ASSERT_TRUE(autostartDir.isValid());
+
+    auto app = addApplication("autostart-test", "[Desktop Entry]\nType=Application\nName=Autostart Test\nExec=autostart-test\n");
+    ASSERT_FALSE(app.isNull());
+
+    const auto autostartPath = autostartDir.filePath("autostart-test.desktop");
+    ASSERT_TRUE(writeFile(autostartPath,
+                          "[Desktop Entry]\nType=Application\nName=Autostart Test\nExec=autostart-test\n"
+                          "X-Deepin-GenerateSource=" + desktopFilePath("autostart-test").toLocal8Bit() + "\n"));
+    auto autostartEntry = parseEntry(autostartPath);
+    ASSERT_NE(autostartEntry, nullptr);
+    app->setAutostartSource({autostartPath, std::move(*autostartEntry)});
+
+    // brings the generated file in line with the application once.
+    app->syncGeneratedAutostartEntry();
+    const auto old = QDateTime::currentDateTime().addDays(-1);
+    {
+        QFile autostartFile{autostartPath};
+        ASSERT_TRUE(autostartFile.open(QFile::ReadWrite));
+        ASSERT_TRUE(autostartFile.setFileTime(old, QFileDevice::FileModificationTime));
+    }
+
+    // the autostart directory is watched, a write would schedule the next reload.
+    reload();
+    auto reparsed = DesktopFile::createDesktopFile(QFileInfo{desktopFilePath("autostart-test")}, QString{"autostart-test"});
+    ASSERT_TRUE(reparsed.has_value());
+    auto entry = parseEntry(desktopFilePath("autostart-test"));
+    ASSERT_NE(entry, nullptr);
+    m_am.updateApplication(app, std::move(reparsed).value(), std::move(entry));
+
+    EXPECT_EQ(QFileInfo{autostartPath}.lastModified().toSecsSinceEpoch(), old.toSecsSinceEpoch());
+}
+
+TEST_F(ApplicationManagerTest, reloadSkipsFileUnchangedSinceLastUpdate)
+{
+    if (!hasSessionBus()) {
+        GTEST_SKIP() << "ApplicationsChanged is sent on the session bus.";
+    }
+
+    auto name = [](const QSharedPointer<ApplicationService> &app) {
+        return app->m_properties->name.value(fromStaticRaw(DesktopFileDefaultKeyLocale));
+    };
+
+    auto app = addApplication("stat-test", "[Desktop Entry]\nType=Application\nName=First\nExec=stat-test\n");
+    ASSERT_FALSE(app.isNull());
+
+    const auto path = desktopFilePath("stat-test");
+    ASSERT_TRUE(writeFile(path, "[Desktop Entry]\nType=Application\nName=Second\nExec=stat-test\n"));
+    {
+        QFile changed{path};
+        ASSERT_TRUE(changed.open(QFile::ReadWrite));
+        ASSERT_TRUE(changed.setFileTime(QDateTime::currentDateTime().addDays(1), QFileDevice::FileModificationTime));
+    }
+    reload();
+    ASSERT_EQ(name(app), QString{"Second"});
+
+    // an entry which isn't the one on disk survives only if the next reload doesn't parse the file again.
+    QTemporaryDir otherDir;
+    ASSERT_TRUE(otherDir.isValid());
+    const auto injectedPath = otherDir.filePath("injected.desktop");
+    ASSERT_TRUE(writeFile(injectedPath, "[Desktop Entry]\nType=Application\nName=Injected\nExec=stat-test\n"));
+    auto entry = parseEntry(injectedPath);
+    ASSERT_NE(entry, nullptr);
+    app->resetEntry(entry.release());
+
+    reload();
+    EXPECT_EQ(name(app), QString{"Injected"});
+}
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "constant.h"
+#include "dbus/applicationobjecttree.h"
+#include "global.h"
+#include "utils.h"
+#include <gtest/gtest.h>
+#include <QDBusError>
+#include <QDBusVariant>
+
+class TestApplicationObjectTree : public ApplicationManagerTest
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_NO_FATAL_FAILURE(ApplicationManagerTest::SetUp());
+        m_am.m_objectTree.reset(new ApplicationObjectTree{&m_am});
+        m_app = addApplication("tree-test",
+                               "[Desktop Entry]\nType=Application\nName=Tree Test\nExec=tree-test\nCategories=Utility;\n");
+        ASSERT_FALSE(m_app.isNull());
+    }
+
+    void TearDown() override
+    {
+        m_am.m_applicationList.clear();
+        m_app.reset();
+    }
+
+    [[nodiscard]] QDBusMessage call(const QString &interface, const QString &member, const QVariantList &args = {}) const
+    {
+        auto msg = QDBusMessage::createMethodCall(
+            fromStaticRaw(DDEApplicationManager1ServiceName), m_app->applicationPath().path(), interface, member);
+        msg.setArguments(args);
+        return msg;
+    }
+
+    QSharedPointer<ApplicationService> m_app;
+};
+
+TEST_F(TestApplicationObjectTree, noAdaptors)
+{
+    EXPECT_TRUE(m_app->findChildren<QDBusAbstractAdaptor *>().isEmpty());
+    EXPECT_EQ(m_app->interfaces(),
+              (QStringList{fromStaticRaw(ApplicationInterface), fromStaticRaw(ObjectManagerInterface)}));
+
+    const auto interfaces = m_app->interfacesAndProperties();
+    EXPECT_EQ(interfaces.size(), 2);
+    EXPECT_EQ(interfaces.value(fromStaticRaw(ApplicationInterface)).value("ID").toString(), QString{"tree-test"});
+
+    const auto xml = m_am.m_objectTree->introspect(m_app->applicationPath().path());
+    EXPECT_TRUE(xml.contains(fromStaticRaw(ApplicationInterface)));
+    EXPECT_TRUE(xml.contains(fromStaticRaw(ObjectManagerInterface)));
+}
+
+TEST_F(TestApplicationObjectTree, properties)
+{
+    const auto &tree = *m_am.m_objectTree;
+    const auto properties = fromStaticRaw(SystemdPropInterfaceName);
+
+    auto reply = tree.dispatch(call(properties, "Get", {fromStaticRaw(ApplicationInterface), QString{"Categories"}}));
+    ASSERT_TRUE(reply.has_value());
+    ASSERT_EQ(reply->type(), QDBusMessage::ReplyMessage);
+    EXPECT_EQ(reply->arguments().constFirst().value<QDBusVariant>().variant().toStringList(), QStringList{"Utility"});
+
+    reply = tree.dispatch(call(properties, "GetAll", {fromStaticRaw(ApplicationInterface)}));
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->arguments().constFirst().toMap(), m_app->applicationInterfaceProperties());
+
+    reply = tree.dispatch(call(properties, "Get", {fromStaticRaw(ApplicationInterface), QString{"NoSuchProperty"}}));
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+
+    reply = tree.dispatch(call(properties, "Set", {fromStaticRaw(ApplicationInterface), QString{"ID"},
+                                                   QVariant::fromValue(QDBusVariant{QString{"other"}})}));
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+    EXPECT_EQ(m_app->id(), QString{"tree-test"});
+
+    reply = tree.dispatch(call(properties, "GetAll", {QString{"org.example.Unknown"}}));
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+}
+
+TEST_F(TestApplicationObjectTree, routing)
+{
+    const auto &tree = *m_am.m_objectTree;
+
+    // introspection is left to QtDBus, it asks introspect() for our part.
+    EXPECT_FALSE(tree.dispatch(call("org.freedesktop.DBus.Introspectable", "Introspect")).has_value());
+
+    auto unknownPath = QDBusMessage::createMethodCall(fromStaticRaw(DDEApplicationManager1ServiceName),
+                                                      getObjectPathFromAppId("not-installed"),
+                                                      fromStaticRaw(SystemdPropInterfaceName),
+                                                      "GetAll");
+    unknownPath.setArguments({fromStaticRaw(ApplicationInterface)});
+    EXPECT_FALSE(tree.dispatch(unknownPath).has_value());
+
+    auto reply = tree.dispatch(call(fromStaticRaw(ApplicationInterface), "NoSuchMethod"));
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+}
+
+TEST_F(TestApplicationObjectTree, errors)
+{
+    const auto &tree = *m_am.m_objectTree;
+
+    // there's no storage to keep the environ in.
+    auto reply = tree.dispatch(call(fromStaticRaw(SystemdPropInterfaceName),
+                                    "Set",
+                                    {fromStaticRaw(ApplicationInterface),
+                                     QString{"Environ"},
+                                     QVariant::fromValue(QDBusVariant{QString{"KEY=value"}})}));
+    ASSERT_TRUE(reply.has_value());
+    ASSERT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+    EXPECT_EQ(reply->errorName(), QDBusError::errorString(QDBusError::InternalError));
+    EXPECT_TRUE(m_app->environ().isEmpty());
+
+    // the reason Launch found is passed on instead of a generic one.
+    reply = tree.dispatch(call(fromStaticRaw(ApplicationInterface),
+                               "Launch",
+                               {QString{}, QStringList{}, QVariantMap{{fromStaticRaw(BuiltInAutostartOption), true}}}));
+    ASSERT_TRUE(reply.has_value());
+    ASSERT_EQ(reply->type(), QDBusMessage::ErrorMessage);
+    EXPECT_EQ(reply->errorName(), QDBusError::errorString(QDBusError::Failed));
+    EXPECT_EQ(reply->errorMessage(), QString{"This application is not set to autostart."});
+}
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "applicationproperties.h"
+#include "desktopentry.h"
+#include <gtest/gtest.h>
+#include <QTemporaryFile>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+constexpr auto &TestDesktopContent = "[Desktop Entry]\n"
+                                     "Type=Application\n"
+                                     "Name=Example\n"
+                                     "Name[zh_CN]=示例\n"
+                                     "GenericName=Editor\n"
+                                     "Exec=example %F\n"
+                                     "Icon=example\n"
+                                     "Categories=Utility;TextEditor;\n"
+                                     "Actions=new;\n"
+                                     "Terminal=false\n"
+                                     "X-linglong=org.example\n"
+                                     "\n"
+                                     "[Desktop Action new]\n"
+                                     "Name=New Window\n"
+                                     "Exec=example --new\n"
+                                     "Icon=example-new\n";
+
+std::unique_ptr<DesktopEntry> parseEntry(const QByteArray &content, ValueDecoding decoding = ValueDecoding::Eager)
+{
+    QTemporaryFile file;
+    if (!file.open() || file.write(content) != content.size() || !file.seek(0)) {
+        return nullptr;
+    }
+
+    auto entry = std::make_unique<DesktopEntry>();
+    if (entry->parse(file, decoding) != ParserError::NoError) {
+        return nullptr;
+    }
+    return entry;
+}
+}  // namespace
+
+TEST(ApplicationProperties, fromEntry)
+{
+    for (auto decoding : {ValueDecoding::Eager, ValueDecoding::LazyMemoized}) {
+        auto entry = parseEntry(TestDesktopContent, decoding);
+        ASSERT_NE(entry, nullptr);
+
+        const auto properties = ApplicationProperties::fromEntry(*entry, 1);
+        EXPECT_EQ(properties->version, 1);
+        EXPECT_EQ(properties->actions, QStringList{u"new"_s});
+        EXPECT_EQ(properties->categories, (QStringList{u"Utility"_s, u"TextEditor"_s}));
+        EXPECT_EQ(properties->name.value(u"default"_s), u"Example"_s);
+        EXPECT_EQ(properties->name.value(u"zh_CN"_s), u"示例"_s);
+        EXPECT_EQ(properties->genericName.value(u"default"_s), u"Editor"_s);
+        EXPECT_EQ(properties->actionName.value(u"new"_s).value(u"default"_s), u"New Window"_s);
+        EXPECT_EQ(properties->execs.value(u"Desktop Entry"_s), u"example %F"_s);
+        EXPECT_EQ(properties->execs.value(u"Desktop Action new"_s), u"example --new"_s);
+        EXPECT_EQ(properties->icons.value(u"Desktop Entry"_s), u"example"_s);
+        EXPECT_EQ(properties->icons.value(u"Desktop Action new"_s), u"example-new"_s);
+        EXPECT_FALSE(properties->terminal);
+        EXPECT_FALSE(properties->noDisplay);
+        EXPECT_FALSE(properties->xFlatpak);
+        EXPECT_EQ(properties->xLinglongAppId, u"org.example"_s);
+    }
+}
+
+TEST(ApplicationProperties, diff)
+{
+    auto origin = parseEntry(TestDesktopContent);
+    ASSERT_NE(origin, nullptr);
+    const auto before = ApplicationProperties::fromEntry(*origin, 1);
+    EXPECT_EQ(before->diff(*ApplicationProperties::fromEntry(*origin, 2)).toInt(), 0U);
+
+    auto changed = parseEntry(QByteArray{TestDesktopContent}
+                                  .replace("Name=New Window", "Name=Open Window")
+                                  .replace("Terminal=false", "Terminal=true"));
+    ASSERT_NE(changed, nullptr);
+    const auto after = ApplicationProperties::fromEntry(*changed, 2);
+    EXPECT_EQ(before->diff(*after).toInt(), (ApplicationProperties::ActionName | ApplicationProperties::Terminal).toInt());
+}
+
+TEST(ApplicationProperties, diffLinglongAppId)
+{
+    auto origin = parseEntry(TestDesktopContent);
+    ASSERT_NE(origin, nullptr);
+    const auto before = ApplicationProperties::fromEntry(*origin, 1);
+
+    // both have an ID, but a different one.
+    auto changed = parseEntry(QByteArray{TestDesktopContent}.replace("X-linglong=org.example", "X-linglong=org.other"));
+    ASSERT_NE(changed, nullptr);
+    const auto after = ApplicationProperties::fromEntry(*changed, 2);
+    EXPECT_EQ(after->xLinglongAppId, u"org.other"_s);
+    EXPECT_EQ(before->diff(*after).toInt(), static_cast<uint>(ApplicationProperties::XLinglong));
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "changejournal.h"
+#include <gtest/gtest.h>
+
+namespace {
+const QDBusObjectPath AppA{"/org/desktopspec/ApplicationManager1/a"};
+const QDBusObjectPath AppB{"/org/desktopspec/ApplicationManager1/b"};
+}  // namespace
+
+TEST(ChangeJournal, changesSince)
+{
+    ChangeJournal journal;
+    const auto start = journal.sequence();
+    EXPECT_GT(start, 0U);
+
+    // nothing happened yet, but the client is up to date.
+    auto changes = journal.changesSince(start);
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_TRUE(changes->isEmpty());
+
+    // 0 and numbers from the future (e.g. handed out by a previous process) need a full resync.
+    EXPECT_FALSE(journal.changesSince(0).has_value());
+    EXPECT_FALSE(journal.changesSince(start + 1).has_value());
+
+    const auto added = journal.record(ObjectChange::ObjectAdded, AppA);
+    journal.record(ObjectChange::PropertiesChanged, AppB, {"Name"});
+    journal.record(ObjectChange::ObjectRemoved, AppB);
+    EXPECT_EQ(journal.sequence(), start + 3);
+
+    changes = journal.changesSince(start);
+    ASSERT_TRUE(changes.has_value());
+    ASSERT_EQ(changes->size(), 3);
+    EXPECT_EQ(changes->at(0).kind, ObjectChange::ObjectAdded);
+    EXPECT_EQ(changes->at(0).object, AppA);
+    EXPECT_EQ(changes->at(1).properties, QStringList{"Name"});
+    EXPECT_EQ(changes->at(2).sequence, journal.sequence());
+
+    changes = journal.changesSince(added);
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_EQ(changes->size(), 2);
+}
+
+TEST(ChangeJournal, foldsProperties)
+{
+    ChangeJournal journal;
+    const auto start = journal.sequence();
+
+    journal.record(ObjectChange::PropertiesChanged, AppA, {"Name"});
+    const auto seen = journal.record(ObjectChange::PropertiesChanged, AppA, {"Icons"});
+    journal.record(ObjectChange::PropertiesChanged, AppA, {"Name", "Categories"});
+    EXPECT_EQ(journal.size(), 1);
+
+    auto changes = journal.changesSince(start);
+    ASSERT_TRUE(changes.has_value());
+    ASSERT_EQ(changes->size(), 1);
+    EXPECT_EQ(changes->first().properties, (QStringList{"Name", "Icons", "Categories"}));
+    EXPECT_EQ(changes->first().sequence, journal.sequence());
+
+    // a client which saw part of a folded change gets all of it again.
+    changes = journal.changesSince(seen);
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_EQ(changes->size(), 1);
+
+    journal.record(ObjectChange::PropertiesChanged, AppB, {"Name"});
+    EXPECT_EQ(journal.size(), 2);
+}
+
+TEST(ChangeJournal, bounded)
+{
+    ChangeJournal journal{4};
+    const auto start = journal.sequence();
+
+    for (int i = 0; i < 6; ++i) {
+        journal.record(i % 2 == 0 ? ObjectChange::ObjectAdded : ObjectChange::ObjectRemoved, AppA);
+    }
+    EXPECT_EQ(journal.size(), 4);
+
+    // the first two changes were dropped.
+    EXPECT_FALSE(journal.changesSince(start).has_value());
+    EXPECT_FALSE(journal.changesSince(start + 1).has_value());
+
+    auto changes = journal.changesSince(start + 2);
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_EQ(changes->size(), 4);
+    EXPECT_EQ(changes->first().sequence, start + 3);
+
+    changes = journal.changesSince(journal.sequence());
+    ASSERT_TRUE(changes.has_value());
+    EXPECT_TRUE(changes->isEmpty());
+}
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "constant.h"
+#include "dconfigcache.h"
+#include "global.h"
+#include <gtest/gtest.h>
+#include <DConfig>
+#include <QStringBuilder>
+#include <memory>
+
+using namespace Qt::StringLiterals;
+
+DCORE_USE_NAMESPACE
+
+namespace {
+// values of the fake config, shared with the test so it can change them behind the cache.
+using Values = std::shared_ptr<QVariantMap>;
+
+class FakeBackend : public DConfigBackend
+{
+public:
+    explicit FakeBackend(Values values)
+        : m_values(std::move(values))
+    {
+    }
+
+    bool isValid() const override { return true; }
+    bool load(const QString &) override { return true; }
+    QStringList keyList() const override { return m_values->keys(); }
+    QVariant value(const QString &key, const QVariant &fallback) const override { return m_values->value(key, fallback); }
+    void setValue(const QString &key, const QVariant &value) override { m_values->insert(key, value); }
+
+private:
+    Values m_values;
+};
+
+class DConfigCacheTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_values = std::make_shared<QVariantMap>();
+        m_values->insert(fromStaticRaw(AppExtraEnvironments), QStringList{u"FOO=1"_s});
+        m_values->insert(fromStaticRaw(AppEnvironmentsBlacklist), QStringList{u"BAR"_s});
+
+        m_cache.m_create = [this](const QString &subpath) -> DConfig * {
+            ++m_created;
+            if (!m_available) {
+                return nullptr;
+            }
+            m_config = DConfig::create(new FakeBackend{m_values},
+                                       fromStaticRaw(ApplicationServiceID),
+                                       fromStaticRaw(ApplicationManagerConfig),
+                                       subpath);
+            return m_config;
+        };
+    }
+
+    void TearDown() override { m_cache.clear(); }
+
+    DConfigCache m_cache;
+    Values m_values;
+    DConfig *m_config{nullptr};
+    bool m_available{true};
+    int m_created{0};
+};
+}  // namespace
+
+TEST_F(DConfigCacheTest, hit)
+{
+    const auto &env = m_cache.launchEnvironment(u"test"_s);
+    EXPECT_EQ(env.envs, QStringList{u"FOO=1"_s});
+    EXPECT_EQ(env.unsetEnvs, QStringList{u"BAR"_s});
+    EXPECT_EQ(m_created, 1);
+
+    // the second launch reads neither the config nor the backend.
+    m_values->insert(fromStaticRaw(AppExtraEnvironments), QStringList{u"FOO=2"_s});
+    EXPECT_EQ(m_cache.launchEnvironment(u"test"_s).envs, QStringList{u"FOO=1"_s});
+    EXPECT_EQ(m_created, 1);
+}
+
+TEST_F(DConfigCacheTest, retry)
+{
+    m_available = false;
+    EXPECT_TRUE(m_cache.launchEnvironment(u"test"_s).envs.isEmpty());
+    EXPECT_EQ(m_created, 1);
+
+    // the failure isn't cached as an empty environment, but the config isn't created again before the back-off.
+    m_available = true;
+    EXPECT_TRUE(m_cache.launchEnvironment(u"test"_s).envs.isEmpty());
+    EXPECT_EQ(m_created, 1);
+    EXPECT_FALSE(m_cache.m_entries[u"/test"_s].launchEnvironment.has_value());
+
+    m_cache.m_entries[u"/test"_s].retry.setRemainingTime(0);
+    EXPECT_EQ(m_cache.launchEnvironment(u"test"_s).envs, QStringList{u"FOO=1"_s});
+    EXPECT_EQ(m_created, 2);
+}
+
+TEST_F(DConfigCacheTest, invalidate)
+{
+    EXPECT_EQ(m_cache.launchEnvironment(u"test"_s).envs, QStringList{u"FOO=1"_s});
+    ASSERT_NE(m_config, nullptr);
+
+    QStringList changed;
+    QObject::connect(&m_cache, &DConfigCache::valueChanged, [&changed](const QString &subpath, const QString &key) {
+        changed.append(QString{subpath % u':' % key});
+    });
+
+    m_values->insert(fromStaticRaw(AppExtraEnvironments), QStringList{u"FOO=2"_s});
+    emit m_config->valueChanged(fromStaticRaw(AppExtraEnvironments));
+
+    EXPECT_EQ(changed, QStringList{QString{u"/test:"_s % fromStaticRaw(AppExtraEnvironments)}});
+    EXPECT_EQ(m_cache.launchEnvironment(u"test"_s).envs, QStringList{u"FOO=2"_s});
+    // the config itself is kept.
+    EXPECT_EQ(m_created, 1);
+
+    m_cache.remove(u"/test"_s);
+    EXPECT_EQ(m_cache.m_entries.count(u"/test"_s), 0);
+    EXPECT_EQ(m_cache.launchEnvironment(u"test"_s).envs, QStringList{u"FOO=2"_s});
+    EXPECT_EQ(m_created, 2);
+}
+
+TEST_F(DConfigCacheTest, prefetch)
+{
+    for (auto i = 0; i < DConfigCache::PrefetchBatch + 2; ++i) {
+        m_cache.prefetch(u"test%1"_s.arg(i));
+    }
+    // a removed application isn't prefetched.
+    m_cache.remove(u"/test0"_s);
+    EXPECT_EQ(m_created, 0);
+    ASSERT_TRUE(m_cache.m_prefetchTimer.isActive());
+    m_cache.m_prefetchTimer.stop();
+
+    // one batch per turn of the event loop.
+    m_cache.prefetchPending();
+    EXPECT_EQ(m_created, DConfigCache::PrefetchBatch);
+    EXPECT_TRUE(m_cache.m_prefetchTimer.isActive());
+    m_cache.m_prefetchTimer.stop();
+
+    m_cache.prefetchPending();
+    EXPECT_EQ(m_created, DConfigCache::PrefetchBatch + 1);
+    EXPECT_FALSE(m_cache.m_prefetchTimer.isActive());
+    EXPECT_EQ(m_cache.m_entries.count(u"/test0"_s), 0);
+
+    EXPECT_TRUE(m_cache.m_entries[u"/test1"_s].launchEnvironment.has_value());
+    EXPECT_EQ(m_cache.launchEnvironment(u"test1"_s).envs, QStringList{u"FOO=1"_s});
+    EXPECT_EQ(m_created, DConfigCache::PrefetchBatch + 1);
+}
@@ -92,6 +92,37 @@ TEST_F(TestDesktopEntry, prase)
     EXPECT_TRUE(localeString == "文本编辑器");
 }
 
+TEST_F(TestDesktopEntry, lazyDecoding)
+{
+    const auto &exampleFile = file();
+    ASSERT_FALSE(exampleFile.isNull());
+
+    DesktopEntry eager;
+    ASSERT_EQ(eager.parse(*exampleFile), ParserError::NoError);
+
+    for (auto decoding : {ValueDecoding::Lazy, ValueDecoding::LazyMemoized}) {
+        DesktopEntry lazy;
+        ASSERT_EQ(lazy.parse(*exampleFile, decoding), ParserError::NoError);
+        EXPECT_EQ(lazy, eager);
+
+        auto name = lazy.value(u"Desktop Entry"_s, u"Name"_s);
+        ASSERT_TRUE(name);
+        const auto &nameVal = name->get();
+        EXPECT_EQ(nameVal.userType(), QMetaType::fromType<EncodedLocaleMap>().id());
+        EXPECT_EQ(toString(nameVal), u"Text Editor"_s);
+        EXPECT_EQ(toLocaleString(nameVal, QLocale{"zh_CN"}), u"文本编辑器"_s);
+        EXPECT_EQ(nameVal.value<QStringMap>(), eager.value(u"Desktop Entry"_s, u"Name"_s)->get().value<QStringMap>());
+
+        auto exec = lazy.value(u"Desktop Entry"_s, u"Exec"_s);
+        ASSERT_TRUE(exec);
+        EXPECT_EQ(exec->get().userType(), QMetaType::fromType<EncodedValue>().id());
+        EXPECT_EQ(exec->get().toString(), u"deepin-editor %F"_s);
+        EXPECT_EQ(toString(exec->get()), u"deepin-editor %F"_s);
+
+        EXPECT_EQ(toString(lazy.data()), toString(eager.data()));
+    }
+}
+
 TEST(DesktopFileParser, desktopEntryMustBeFirstGroup)
 {
     QTemporaryFile file;
@@ -131,3 +162,28 @@ TEST(DesktopFileParser, serializeKeepsDesktopActionGroups)
     EXPECT_TRUE(serialized.contains(u"Exec=example --one\n"_s));
     EXPECT_TRUE(serialized.contains(u"Exec=example --two\n"_s));
 }
+
+TEST(DesktopFileParser, contentHash)
+{
+    auto parse = [](const QByteArray &content) {
+        QTemporaryFile file;
+        if (!file.open() || file.write(content) != content.size() || !file.seek(0)) {
+            return std::size_t{0};
+        }
+
+        DesktopEntry entry;
+        return entry.parse(file) == ParserError::NoError ? entry.contentHash() : std::size_t{0};
+    };
+
+    const auto origin = parse("[Desktop Entry]\nType=Application\nName=Example\nExec=example\n");
+    ASSERT_NE(origin, 0);
+
+    // comments and blank lines don't change the entry, so they don't change the hash either.
+    EXPECT_EQ(parse("# comment\n[Desktop Entry]\n\nType=Application\nName=Example\n# comment\nExec=example\n"), origin);
+    EXPECT_NE(parse("[Desktop Entry]\nType=Application\nName=Example2\nExec=example\n"), origin);
+    EXPECT_NE(parse("[Desktop Entry]\nType=Application\nName=Example\nExec=example\nNoDisplay=true\n"), origin);
+
+    DesktopEntry modified;
+    modified.insert(fromStaticRaw(DesktopFileEntryKey), fromStaticRaw(DesktopEntryType), u"Application"_s);
+    EXPECT_EQ(modified.contentHash(), 0);
+}
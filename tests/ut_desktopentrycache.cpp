@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopentry.h"
+#include "desktopentrycache.h"
+#include "global.h"
+#include <gtest/gtest.h>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+constexpr auto &TestDesktopContent = "[Desktop Entry]\n"
+                                     "Name=Test\n"
+                                     "Name[zh_CN]=测试\n"
+                                     "Exec=/usr/bin/test %U\n"
+                                     "Type=Application\n"
+                                     "Actions=new;\n"
+                                     "\n"
+                                     "[Desktop Action new]\n"
+                                     "Name=New\n"
+                                     "Exec=/usr/bin/test --new\n";
+
+std::optional<DesktopFile> writeDesktopFile(const QString &path, const QByteArray &content)
+{
+    QFile file{path};
+    if (!file.open(QFile::WriteOnly | QFile::Truncate) || file.write(content) != content.size()) {
+        return std::nullopt;
+    }
+    file.close();
+
+    return DesktopFile::createDesktopFile(QFileInfo{path}, u"test"_s);
+}
+}  // namespace
+
+TEST(DesktopEntryCache, roundTrip)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    auto file = writeDesktopFile(dir.filePath(u"test.desktop"_s), TestDesktopContent);
+    ASSERT_TRUE(file.has_value());
+
+    DesktopEntry entry;
+    ASSERT_EQ(entry.parse(*file), ParserError::NoError);
+
+    const auto cachePath = dir.filePath(u"cache/desktop-entries.cache"_s);
+    {
+        DesktopEntryCache cache{cachePath};
+        EXPECT_FALSE(cache.load());
+        EXPECT_EQ(cache.find(*file), nullptr);
+
+        cache.insert(*file, entry);
+        EXPECT_TRUE(cache.isDirty());
+        ASSERT_TRUE(cache.save());
+        EXPECT_FALSE(cache.isDirty());
+    }
+
+    DesktopEntryCache cache{cachePath};
+    ASSERT_TRUE(cache.load());
+    EXPECT_EQ(cache.size(), 1);
+
+    auto cached = cache.find(*file);
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(*cached, entry);
+    EXPECT_NE(cached->contentHash(), 0);
+    EXPECT_EQ(cached->contentHash(), entry.contentHash());
+    EXPECT_FALSE(cache.isDirty());
+}
+
+TEST(DesktopEntryCache, touchKeepsRecord)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    auto file = writeDesktopFile(dir.filePath(u"test.desktop"_s), TestDesktopContent);
+    ASSERT_TRUE(file.has_value());
+
+    DesktopEntry entry;
+    ASSERT_EQ(entry.parse(*file), ParserError::NoError);
+
+    const auto cachePath = dir.filePath(u"desktop-entries.cache"_s);
+    DesktopEntryCache cache{cachePath};
+    EXPECT_FALSE(cache.touch(*file));
+    cache.insert(*file, entry);
+    EXPECT_TRUE(cache.touch(*file));
+    ASSERT_TRUE(cache.save());
+
+    // a touched record survives a save without being deserialized.
+    EXPECT_TRUE(cache.touch(*file));
+    EXPECT_FALSE(cache.isDirty());
+    ASSERT_TRUE(cache.save());
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(DesktopEntryCache, invalidateByStat)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto desktopPath = dir.filePath(u"test.desktop"_s);
+    auto file = writeDesktopFile(desktopPath, TestDesktopContent);
+    ASSERT_TRUE(file.has_value());
+
+    DesktopEntry entry;
+    ASSERT_EQ(entry.parse(*file), ParserError::NoError);
+
+    const auto cachePath = dir.filePath(u"desktop-entries.cache"_s);
+    {
+        DesktopEntryCache cache{cachePath};
+        cache.insert(*file, entry);
+        ASSERT_TRUE(cache.save());
+    }
+
+    {
+        QFile touched{desktopPath};
+        ASSERT_TRUE(touched.open(QFile::ReadWrite));
+        ASSERT_TRUE(touched.setFileTime(QDateTime::currentDateTime().addDays(-1), QFileDevice::FileModificationTime));
+    }
+
+    auto changed = DesktopFile::createDesktopFile(QFileInfo{desktopPath}, u"test"_s);
+    ASSERT_TRUE(changed.has_value());
+
+    DesktopEntryCache cache{cachePath};
+    ASSERT_TRUE(cache.load());
+    EXPECT_EQ(cache.find(*changed), nullptr);
+
+    // the stale record wasn't used, so it's dropped on the next save.
+    EXPECT_TRUE(cache.isDirty());
+    ASSERT_TRUE(cache.save());
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(DesktopEntryCache, brokenFile)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto cachePath = dir.filePath(u"desktop-entries.cache"_s);
+    QFile broken{cachePath};
+    ASSERT_TRUE(broken.open(QFile::WriteOnly));
+    ASSERT_GT(broken.write("definitely not a cache"), 0);
+    broken.close();
+
+    DesktopEntryCache cache{cachePath};
+    EXPECT_FALSE(cache.load());
+    EXPECT_EQ(cache.size(), 0);
+}
@@ -2,7 +2,9 @@
 //
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
+#include "desktopentry.h"
 #include "desktopfileparser.h"
+#include "filecontent.h"
 #include "global.h"
 #include <gtest/gtest.h>
 #include <QVariant>
@@ -102,6 +104,45 @@ TEST(DesktopFileParserToString, actionsBasic)
     EXPECT_TRUE(result.contains("Exec=/usr/bin/test --new\n"));
 }
 
+namespace {
+QStringList capturedWarnings;
+
+void captureWarnings(QtMsgType type, const QMessageLogContext &, const QString &message)
+{
+    if (type == QtWarningMsg) {
+        capturedWarnings.append(message);
+    }
+}
+}  // namespace
+
+TEST(DesktopFileParserToString, actionsEncodedValue)
+{
+    Groups groups;
+
+    const QByteArray raw{"new;"};
+    QMap<QString, QVariant> entry;
+    entry.insert("Type", "Application");
+    entry.insert("Name", "TestApp");
+    entry.insert("Actions", QVariant::fromValue(EncodedValue{FileContent::fromByteArray(raw), 0, raw.size(), true}));
+    entry.insert("Exec", "/usr/bin/test");
+    groups.insert(fromStaticRaw(DesktopFileEntryKey), entry);
+
+    QMap<QString, QVariant> actionEntry;
+    actionEntry.insert("Name", "New Window");
+    actionEntry.insert("Exec", "/usr/bin/test --new");
+    groups.insert(fromStaticRaw(DesktopFileActionKey) % "new", actionEntry);
+
+    capturedWarnings.clear();
+    const auto previous = qInstallMessageHandler(captureWarnings);
+    const auto result = toString(groups);
+    qInstallMessageHandler(previous);
+
+    EXPECT_TRUE(result.contains("Actions=new;\n"));
+    EXPECT_TRUE(result.contains("[Desktop Action new]\n"));
+    EXPECT_TRUE(result.contains("Exec=/usr/bin/test --new\n"));
+    EXPECT_TRUE(capturedWarnings.isEmpty()) << capturedWarnings.join(u'\n').toStdString();
+}
+
 TEST(DesktopFileParserToString, actionsWithMultipleLocales)
 {
     Groups groups;
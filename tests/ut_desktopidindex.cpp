@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopentry.h"
+#include "desktopidindex.h"
+#include <gtest/gtest.h>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+class TestDesktopIdIndex : public testing::Test
+{
+public:
+    // the index is process-wide, other tests expect the file system lookup.
+    void TearDown() override { DesktopIdIndex::instance().clear(); }
+};
+
+TEST_F(TestDesktopIdIndex, lookup)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto path = dir.filePath(u"org.example.App.desktop"_s);
+    {
+        QFile file{path};
+        ASSERT_TRUE(file.open(QFile::WriteOnly));
+        ASSERT_GT(file.write("[Desktop Entry]\nType=Application\nName=Example\nExec=example\n"), 0);
+    }
+
+    auto &index = DesktopIdIndex::instance();
+    EXPECT_FALSE(index.isPopulated());
+
+    index.reset(QHash<QString, QString>{{u"org.example.App"_s, path}});
+    EXPECT_TRUE(index.isPopulated());
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_EQ(index.path(u"org.example.App"_s), path);
+
+    ParserError err{ParserError::NoError};
+    auto file = DesktopFile::searchDesktopFileById(u"org.example.App", err);
+    ASSERT_TRUE(file.has_value());
+    EXPECT_EQ(err, ParserError::NoError);
+    EXPECT_EQ(file->desktopId(), u"org.example.App"_s);
+    EXPECT_EQ(file->sourcePath(), path);
+
+    // a populated index is authoritative, unknown IDs aren't searched for.
+    EXPECT_FALSE(DesktopFile::searchDesktopFileById(u"org.example.Missing", err).has_value());
+    EXPECT_EQ(err, ParserError::NotFound);
+
+    index.remove(u"org.example.App"_s);
+    EXPECT_TRUE(index.path(u"org.example.App"_s).isEmpty());
+    EXPECT_FALSE(DesktopFile::searchDesktopFileById(u"org.example.App", err).has_value());
+
+    index.insert(u"org.example.App"_s, path);
+    EXPECT_EQ(index.path(u"org.example.App"_s), path);
+
+    // the file is gone but the index hasn't caught up yet.
+    ASSERT_TRUE(QFile::remove(path));
+    EXPECT_FALSE(DesktopFile::searchDesktopFileById(u"org.example.App", err).has_value());
+    EXPECT_EQ(err, ParserError::NotFound);
+}
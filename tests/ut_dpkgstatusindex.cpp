@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dpkgstatusindex.h"
+#include <gtest/gtest.h>
+#include <QFile>
+#include <QTemporaryDir>
+#include <cstdio>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+constexpr auto StatusContent = R"(Package: dde-calendar
+Status: install ok installed
+Priority: optional
+Architecture: amd64
+Version: 5.14.5-1
+Description: Calendar for Deepin Desktop Environment
+ Multi-line description,
+ Version: not a field.
+
+Package: removed-app
+Status: deinstall ok config-files
+Architecture: amd64
+Version: 1.0
+
+Package: libfoo
+Status: install ok installed
+Architecture: amd64
+Version: 2.0-1
+
+Package: libfoo
+Status: install ok installed
+Architecture: i386
+Version: 2.0-2
+
+Package: held-app
+Status: hold ok installed
+Version: 3:1.2~rc1
+)";
+
+// replaces the file the same way dpkg does.
+bool replaceFile(const QString &path, const QByteArray &content)
+{
+    const auto tmpPath = path + u"-new"_s;
+    QFile file{tmpPath};
+    if (!file.open(QFile::WriteOnly | QFile::Truncate) || file.write(content) != content.size()) {
+        return false;
+    }
+    file.close();
+    return std::rename(QFile::encodeName(tmpPath).constData(), QFile::encodeName(path).constData()) == 0;
+}
+}  // namespace
+
+TEST(DpkgStatusIndex, parse)
+{
+    const auto versions = DpkgStatusIndex::parse(StatusContent);
+    EXPECT_EQ(versions.size(), 3);
+    EXPECT_EQ(versions.value(u"dde-calendar"_s), u"5.14.5-1"_s);
+    EXPECT_EQ(versions.value(u"libfoo"_s), u"2.0-1"_s);
+    EXPECT_EQ(versions.value(u"held-app"_s), u"3:1.2~rc1"_s);
+    EXPECT_FALSE(versions.contains(u"removed-app"_s));
+
+    EXPECT_TRUE(DpkgStatusIndex::parse({}).isEmpty());
+    EXPECT_EQ(DpkgStatusIndex::parse("Package: a\r\nStatus: install ok installed\r\nVersion: 1\r\n").value(u"a"_s), u"1"_s);
+}
+
+TEST(DpkgStatusIndex, refresh)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const auto path = dir.filePath(u"status"_s);
+
+    DpkgStatusIndex index{path};
+    EXPECT_FALSE(index.version(u"dde-calendar"_s).has_value());
+
+    ASSERT_TRUE(replaceFile(path, StatusContent));
+    EXPECT_EQ(index.version(u"dde-calendar"_s), u"5.14.5-1"_s);
+    EXPECT_FALSE(index.version(u"new-app"_s).has_value());
+
+    ASSERT_TRUE(replaceFile(path, "Package: new-app\nStatus: install ok installed\nVersion: 0.1\n"));
+    EXPECT_EQ(index.version(u"new-app"_s), u"0.1"_s);
+    EXPECT_FALSE(index.version(u"dde-calendar"_s).has_value());
+
+    ASSERT_TRUE(QFile::remove(path));
+    EXPECT_FALSE(index.version(u"new-app"_s).has_value());
+}
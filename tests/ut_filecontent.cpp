@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "filecontent.h"
+#include "global.h"
+#include "mimefileparser.h"
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+QByteArray mimeCacheContent(int entries)
+{
+    QByteArray ret{"[MIME Cache]\n"};
+    for (int i = 0; i < entries; ++i) {
+        ret.append("application/x-test-" + QByteArray::number(i) + "=test-" + QByteArray::number(i) + ".desktop;other.desktop;\n");
+    }
+    return ret;
+}
+
+bool writeFile(const QString &path, const QByteArray &content)
+{
+    QFile file{path};
+    return file.open(QFile::WriteOnly | QFile::Truncate) && file.write(content) == content.size();
+}
+}  // namespace
+
+TEST(FileContent, mapLargeFile)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto content = mimeCacheContent(2000);
+    const auto path = dir.filePath(u"mimeinfo.cache"_s);
+    ASSERT_TRUE(writeFile(path, content));
+
+    QFile file{path};
+    ASSERT_TRUE(file.open(QFile::ReadOnly));
+    auto mapped = FileContent::load(file, true);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_TRUE(mapped->isMapped());
+    EXPECT_EQ(mapped->view(), QByteArrayView{content});
+    EXPECT_TRUE(file.atEnd());
+
+    QFile other{path};
+    ASSERT_TRUE(other.open(QFile::ReadOnly));
+    auto read = FileContent::load(other, false);
+    ASSERT_NE(read, nullptr);
+    EXPECT_FALSE(read->isMapped());
+    EXPECT_EQ(read->view(), mapped->view());
+}
+
+TEST(FileContent, readSmallFile)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto content = mimeCacheContent(2);
+    const auto path = dir.filePath(u"mimeapps.list"_s);
+    ASSERT_TRUE(writeFile(path, content));
+
+    QFile file{path};
+    ASSERT_TRUE(file.open(QFile::ReadOnly));
+    auto small = FileContent::load(file, true);
+    ASSERT_NE(small, nullptr);
+    EXPECT_FALSE(small->isMapped());
+    EXPECT_EQ(small->view(), QByteArrayView{content});
+}
+
+TEST(FileContent, parseMappedMimeCache)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto path = dir.filePath(u"mimeinfo.cache"_s);
+    ASSERT_TRUE(writeFile(path, mimeCacheContent(2000)));
+
+    QFile file{path};
+    ASSERT_TRUE(file.open(QFile::ReadOnly | QFile::Text));
+    MimeFileParser parser{file, false};
+    MimeFileParser::Groups groups;
+    ASSERT_EQ(parser.parse(groups), ParserError::NoError);
+    ASSERT_TRUE(parser.m_backing && parser.m_backing->isMapped());
+
+    const auto &cache = groups[fromStaticRaw(mimeCache)];
+    EXPECT_EQ(cache.size(), 2000);
+    EXPECT_EQ(cache.value(u"application/x-test-1999"_s), (QStringList{u"test-1999.desktop"_s, u"other.desktop"_s}));
+}
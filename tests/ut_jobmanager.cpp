@@ -4,6 +4,11 @@
 
 #include "dbus/jobmanager1service.h"
 #include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QPromise>
+#include <optional>
+#include <vector>
 
 class TestJobManager : public testing::Test
 {
@@ -23,12 +28,16 @@ TEST_F(TestJobManager, addJob)
     QVariantList args{{"Application"}, {"Application"}, {"Application"}, {"Application"}};
     auto &manager = service();
     QDBusObjectPath jobPath;
-    QObject::connect(&manager, &JobManager1Service::JobNew, [&](const QDBusObjectPath &job, const QDBusObjectPath &source) {
-        jobPath = job;
-        EXPECT_TRUE(source == sourcePath);
-    });
+    // the handlers refer to locals, they must not outlive this test.
+    QObject context;
+    QObject::connect(
+        &manager, &JobManager1Service::JobNew, &context, [&](const QDBusObjectPath &job, const QDBusObjectPath &source) {
+            jobPath = job;
+            EXPECT_TRUE(source == sourcePath);
+        });
     QObject::connect(&manager,
                      &JobManager1Service::JobRemoved,
+                     &context,
                      [&](const QDBusObjectPath &job, const QString &status, const QVariantList &result) {
                          EXPECT_TRUE(jobPath == job);
                          EXPECT_TRUE(status == "finished");
@@ -45,3 +54,50 @@ TEST_F(TestJobManager, addJob)
         std::move(args));
     QThreadPool::globalInstance()->waitForDone();
 }
+
+TEST_F(TestJobManager, addAsyncJob)
+{
+    QDBusObjectPath sourcePath{"/org/deepin/Test1"};
+    auto &manager = service();
+    QObject context;
+    QDBusObjectPath jobPath;
+    std::optional<QVariantList> removedResult;
+    QObject::connect(&manager,
+                     &JobManager1Service::JobRemoved,
+                     &context,
+                     [&](const QDBusObjectPath &job, [[maybe_unused]] const QString &status, const QVariantList &result) {
+                         if (job == jobPath) {
+                             removedResult = result;
+                         }
+                     });
+
+    std::vector<QPromise<QVariant>> promises(3);
+    std::size_t calls{0};
+    jobPath = manager.addAsyncJob(
+        sourcePath.path(),
+        [&](const QVariant &value) {
+            EXPECT_EQ(value.toUInt(), calls);
+            auto &promise = promises[calls++];
+            promise.start();
+            return promise.future();
+        },
+        QVariantList{0U, 1U, 2U});
+
+    // every func is called before addAsyncJob returns, nothing waits in the thread pool.
+    EXPECT_EQ(calls, promises.size());
+    EXPECT_FALSE(jobPath.path().isEmpty());
+    EXPECT_FALSE(removedResult.has_value());
+
+    // finished out of order, but results keep the order of args.
+    for (std::size_t i : {2U, 0U, 1U}) {
+        promises[i].addResult(QVariant{QString::number(i)});
+        promises[i].finish();
+    }
+
+    QDeadlineTimer deadline{5000};
+    while (!removedResult && !deadline.hasExpired()) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+    }
+    ASSERT_TRUE(removedResult.has_value());
+    EXPECT_EQ(*removedResult, (QVariantList{"0", "1", "2"}));
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "launchhelperclient.h"
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+
+using namespace Qt::StringLiterals;
+
+TEST(LaunchHelperClient, encodeRequest)
+{
+    const auto request = LaunchHelperClient::encodeRequest(42, {u"--unitName=a.service"_s, u"--"_s, u"/usr/bin/测试"_s});
+    EXPECT_EQ(request, QByteArray{"42\0--unitName=a.service\0--\0/usr/bin/\xe6\xb5\x8b\xe8\xaf\x95\0", 43});
+}
+
+TEST(LaunchHelperClient, decodeReply)
+{
+    const auto reply = LaunchHelperClient::decodeReply(QByteArrayView{"7\0done\0", 8});
+    ASSERT_TRUE(reply.has_value());
+    EXPECT_EQ(reply->id, 7U);
+    EXPECT_EQ(reply->result, u"done"_s);
+
+    // a reply must be complete, with a numeric id.
+    EXPECT_FALSE(LaunchHelperClient::decodeReply(QByteArrayView{"7\0done", 6}).has_value());
+    EXPECT_FALSE(LaunchHelperClient::decodeReply(QByteArrayView{"7\0", 2}).has_value());
+    EXPECT_FALSE(LaunchHelperClient::decodeReply(QByteArrayView{"x\0done\0", 7}).has_value());
+    EXPECT_FALSE(LaunchHelperClient::decodeReply(QByteArrayView{"\0done\0", 6}).has_value());
+    EXPECT_FALSE(LaunchHelperClient::decodeReply({}).has_value());
+}
+
+TEST(LaunchHelperClient, restartAfterBrokenConnection)
+{
+    LaunchHelperClient client;
+    // a helper which drops its connection but keeps running.
+    client.m_helper.setProgram(u"/bin/sh"_s);
+    client.m_helper.setArguments({u"-c"_s, u"exec sleep 60 0<&-"_s});
+
+    auto first = client.launch({u"--"_s, u"/usr/bin/true"_s});
+    const QDeadlineTimer deadline{5000};
+    while (!first.isFinished() && !deadline.hasExpired()) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+    }
+    ASSERT_TRUE(first.isFinished());
+    EXPECT_EQ(first.result(), u"failed"_s);
+    EXPECT_EQ(client.m_helper.state(), QProcess::NotRunning);
+
+    // this one keeps its connection, the launch stays pending.
+    client.m_helper.setArguments({u"-c"_s, u"exec sleep 60"_s});
+    auto second = client.launch({u"--"_s, u"/usr/bin/true"_s});
+    EXPECT_NE(client.m_fd, -1);
+    EXPECT_EQ(client.m_helper.state(), QProcess::Running);
+    EXPECT_FALSE(second.isFinished());
+
+    client.stop();
+    EXPECT_TRUE(second.isFinished());
+    EXPECT_EQ(client.m_helper.state(), QProcess::NotRunning);
+}
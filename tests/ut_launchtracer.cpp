@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "launchtracer.h"
+#include <gtest/gtest.h>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+void completeLaunch(LaunchTracer &tracer, const QString &instanceId, const QString &appId, qint64 elapsed)
+{
+    tracer.begin(instanceId, appId, 1000);
+    tracer.mark(instanceId, LaunchStage::Options, 1000 + elapsed / 4);
+    tracer.mark(instanceId, LaunchStage::Exec, 1000 + elapsed / 2);
+    tracer.mark(instanceId, LaunchStage::Scheduled, 1000 + elapsed / 2);
+    tracer.mark(instanceId, LaunchStage::UnitStarted, 1000 + elapsed);
+    tracer.mark(instanceId, LaunchStage::InstanceAdded, 1000 + elapsed);
+}
+}  // namespace
+
+TEST(LaunchTracer, percentiles)
+{
+    LaunchTracer tracer;
+    for (int i = 1; i <= 100; ++i) {
+        const auto instanceId = QString::number(i);
+        tracer.begin(instanceId, u"app"_s, 0);
+        tracer.mark(instanceId, LaunchStage::Options, i);
+    }
+
+    const auto stats = tracer.statistics();
+    ASSERT_EQ(stats.size(), 1);
+    const auto options = stats.value(u"options"_s);
+    EXPECT_EQ(options.count, 100U);
+    EXPECT_EQ(options.p50, 50);
+    EXPECT_EQ(options.p90, 90);
+    EXPECT_EQ(options.p99, 99);
+    EXPECT_EQ(options.max, 100);
+}
+
+TEST(LaunchTracer, perApplication)
+{
+    LaunchTracer tracer;
+    completeLaunch(tracer, u"1"_s, u"fast"_s, 400);
+    completeLaunch(tracer, u"2"_s, u"slow"_s, 4000);
+
+    EXPECT_EQ(tracer.statistics(u"fast"_s).value(u"instanceAdded"_s).max, 400);
+    EXPECT_EQ(tracer.statistics(u"slow"_s).value(u"instanceAdded"_s).max, 4000);
+    EXPECT_EQ(tracer.statistics().value(u"instanceAdded"_s).count, 2U);
+    EXPECT_TRUE(tracer.statistics(u"unknown"_s).isEmpty());
+}
+
+TEST(LaunchTracer, completion)
+{
+    LaunchTracer tracer;
+    completeLaunch(tracer, u"1"_s, u"app"_s, 400);
+    EXPECT_EQ(tracer.pendingCount(), 0);
+
+    // a stage reached again after completion, or of an instance which isn't traced, is ignored.
+    tracer.mark(u"1"_s, LaunchStage::UnitStarted, 5000);
+    tracer.mark(u"2"_s, LaunchStage::UnitStarted, 5000);
+    EXPECT_EQ(tracer.statistics().value(u"unitStarted"_s).count, 1U);
+
+    tracer.begin(u"3"_s, u"app"_s, 0);
+    tracer.mark(u"3"_s, LaunchStage::Options, 10);
+    EXPECT_EQ(tracer.pendingCount(), 1);
+    tracer.fail(u"3"_s, u"failed"_s);
+    EXPECT_EQ(tracer.pendingCount(), 0);
+}
+
+TEST(LaunchTracer, splash)
+{
+    LaunchTracer tracer;
+    tracer.begin(u"1"_s, u"app"_s, 1000);
+    tracer.mark(u"1"_s, LaunchStage::SplashShown, 1100);
+    completeLaunch(tracer, u"2"_s, u"app"_s, 400);
+    tracer.mark(u"1"_s, LaunchStage::Options, 1100);
+    tracer.mark(u"1"_s, LaunchStage::Exec, 1100);
+    tracer.mark(u"1"_s, LaunchStage::Scheduled, 1200);
+    tracer.mark(u"1"_s, LaunchStage::UnitStarted, 1300);
+    tracer.mark(u"1"_s, LaunchStage::InstanceAdded, 1400);
+
+    // kept until the splash is closed.
+    EXPECT_EQ(tracer.pendingCount(), 1);
+    tracer.mark(u"1"_s, LaunchStage::SplashClosed, 1500);
+    EXPECT_EQ(tracer.pendingCount(), 0);
+    EXPECT_EQ(tracer.statistics().value(u"splashClosed"_s).max, 500);
+}
+
+TEST(LaunchTracer, reset)
+{
+    LaunchTracer tracer;
+    completeLaunch(tracer, u"1"_s, u"app"_s, 400);
+    tracer.reset();
+    EXPECT_TRUE(tracer.statistics().isEmpty());
+    EXPECT_TRUE(tracer.statistics(u"app"_s).isEmpty());
+}
+
+TEST(LaunchTracer, eviction)
+{
+    LaunchTracer tracer;
+    for (int i = 0; i < 200; ++i) {
+        tracer.begin(QString::number(i), u"app"_s, i);
+    }
+    EXPECT_EQ(tracer.pendingCount(), 128);
+}
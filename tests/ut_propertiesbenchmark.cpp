@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "applicationadaptor.h"
+#include "global.h"
+#include "utils.h"
+#include <gtest/gtest.h>
+#include <QDBusArgument>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+// Run with --gtest_also_run_disabled_tests --gtest_filter='PropertiesBenchmark.*'
+constexpr int ApplicationCount = 5000;
+constexpr int Rounds = 5;
+
+template <typename Builder>
+double measure(const QList<QSharedPointer<ApplicationService>> &apps, Builder &&build)
+{
+    qint64 best{std::numeric_limits<qint64>::max()};
+    for (int round = 0; round < Rounds; ++round) {
+        QElapsedTimer timer;
+        timer.start();
+
+        ObjectMap objects;
+        for (const auto &app : apps) {
+            objects.insert(app->applicationPath(), build(app.data()));
+        }
+        // include marshalling, this is what a GetManagedObjects reply costs.
+        QDBusArgument argument;
+        argument << objects;
+
+        best = std::min(best, timer.nsecsElapsed());
+    }
+
+    return static_cast<double>(best) / 1e6;
+}
+}  // namespace
+
+using PropertiesBenchmark = ApplicationManagerTest;
+
+TEST_F(PropertiesBenchmark, DISABLED_managedObjects)
+{
+    QList<QSharedPointer<ApplicationService>> apps;
+    apps.reserve(ApplicationCount);
+    for (int i = 0; i < ApplicationCount; ++i) {
+        const auto appId = u"app-%1"_s.arg(i);
+        const auto content = QStringLiteral("[Desktop Entry]\n"
+                                            "Type=Application\n"
+                                            "Name=Application %1\n"
+                                            "Name[zh_CN]=应用 %1\n"
+                                            "Exec=/usr/bin/app-%1 %U\n"
+                                            "Icon=app-%1\n"
+                                            "Categories=Utility;\n"
+                                            "Actions=new;\n"
+                                            "\n"
+                                            "[Desktop Action new]\n"
+                                            "Name=New Window\n"
+                                            "Exec=/usr/bin/app-%1 --new\n")
+                                 .arg(i)
+                                 .toUtf8();
+        auto app = addApplication(appId, content);
+        ASSERT_FALSE(app.isNull());
+        new ApplicationAdaptor{app.data()};
+        apps.append(app);
+    }
+
+    const auto reflection = measure(apps, [](const ApplicationService *app) {
+        return getChildInterfacesAndPropertiesFromObject(app);
+    });
+    const auto typed = measure(apps, [](const ApplicationService *app) { return app->interfacesAndProperties(); });
+
+    std::printf("managed objects of %d applications: reflection %.3f ms, typed %.3f ms\n",
+                ApplicationCount,
+                reflection,
+                typed);
+}
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "constant.h"
+#include "propertiesForwarder.h"
+#include "utils.h"
+#include <gtest/gtest.h>
+
+using TestPropertiesForwarder = ApplicationManagerTest;
+
+TEST_F(TestPropertiesForwarder, coalesceChanges)
+{
+    auto app = addApplication("forwarder-test", "[Desktop Entry]\nType=Application\nName=Forwarder Test\nExec=forwarder-test\n");
+    ASSERT_FALSE(app.isNull());
+
+    PropertiesForwarder forwarder{"/test/forwarder", fromStaticRaw(ApplicationInterface), app.data()};
+    EXPECT_EQ(forwarder.coalescingWindow(), 0);
+
+    const auto before = PropertiesForwarder::stats();
+    emit app->nameChanged();
+    emit app->noDisplayChanged();
+    emit app->nameChanged();
+    EXPECT_TRUE(forwarder.m_flushTimer.isActive());
+
+    const auto after = PropertiesForwarder::stats();
+    EXPECT_EQ(after.notifications - before.notifications, 3);
+
+    auto msg = forwarder.takePendingMessage();
+    ASSERT_TRUE(msg.has_value());
+    EXPECT_EQ(msg->path(), QString{"/test/forwarder"});
+    EXPECT_EQ(msg->member(), QString{"PropertiesChanged"});
+
+    const auto arguments = msg->arguments();
+    ASSERT_EQ(arguments.size(), 3);
+    EXPECT_EQ(arguments.at(0).toString(), fromStaticRaw(ApplicationInterface));
+
+    const auto changed = arguments.at(1).toMap();
+    EXPECT_EQ(changed.size(), 2);
+    EXPECT_TRUE(changed.contains("Name"));
+    EXPECT_EQ(changed.value("NoDisplay").toBool(), false);
+
+    // everything pending was taken, there is nothing left to send.
+    EXPECT_FALSE(forwarder.takePendingMessage().has_value());
+    forwarder.m_flushTimer.stop();
+}
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "recursivefilewatcher.h"
+#include <gtest/gtest.h>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+bool touch(const QString &path)
+{
+    QFile file{path};
+    return file.open(QFile::WriteOnly | QFile::Truncate) && file.write("[Desktop Entry]\n") > 0;
+}
+}  // namespace
+
+class TestRecursiveFileWatcher : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_TRUE(m_dir.isValid());
+        ASSERT_TRUE(QDir{m_dir.path()}.mkpath(u"sub/nested"_s));
+        ASSERT_TRUE(m_watcher.isValid());
+        ASSERT_TRUE(m_watcher.addRoot(m_dir.path()));
+    }
+
+    // inotify queues events synchronously, so they can be read right after the file operations.
+    RecursiveFileWatcher::Changes changes()
+    {
+        m_watcher.readEvents();
+        return m_watcher.takeChanges();
+    }
+
+    QString path(const QString &relative) const { return m_dir.filePath(relative); }
+
+    QTemporaryDir m_dir;
+    RecursiveFileWatcher m_watcher;
+};
+
+TEST_F(TestRecursiveFileWatcher, watchesExistingSubdirectories)
+{
+    EXPECT_EQ(m_watcher.watchCount(), 3);
+
+    ASSERT_TRUE(touch(path(u"sub/nested/app.desktop"_s)));
+    const auto result = changes();
+    EXPECT_TRUE(result.files.contains(path(u"sub/nested/app.desktop"_s)));
+    EXPECT_TRUE(result.directories.isEmpty());
+    EXPECT_FALSE(result.overflowed);
+
+    EXPECT_TRUE(changes().isEmpty());
+}
+
+TEST_F(TestRecursiveFileWatcher, watchesNewSubdirectories)
+{
+    ASSERT_TRUE(QDir{m_dir.path()}.mkpath(u"vendor"_s));
+    auto result = changes();
+    EXPECT_TRUE(result.directories.contains(path(u"vendor"_s)));
+    EXPECT_EQ(m_watcher.watchCount(), 4);
+
+    ASSERT_TRUE(touch(path(u"vendor/app.desktop"_s)));
+    result = changes();
+    EXPECT_TRUE(result.files.contains(path(u"vendor/app.desktop"_s)));
+}
+
+TEST_F(TestRecursiveFileWatcher, movedAndRemovedDirectories)
+{
+    ASSERT_TRUE(QDir{m_dir.path()}.rename(u"sub"_s, u"moved"_s));
+    auto result = changes();
+    EXPECT_TRUE(result.directories.contains(path(u"sub"_s)));
+    EXPECT_TRUE(result.directories.contains(path(u"moved"_s)));
+
+    // the moved tree is watched under its new path.
+    ASSERT_TRUE(touch(path(u"moved/nested/app.desktop"_s)));
+    result = changes();
+    EXPECT_TRUE(result.files.contains(path(u"moved/nested/app.desktop"_s)));
+
+    ASSERT_TRUE(QDir{path(u"moved"_s)}.removeRecursively());
+    result = changes();
+    EXPECT_TRUE(result.directories.contains(path(u"moved"_s)));
+    EXPECT_EQ(m_watcher.watchCount(), 1);
+}
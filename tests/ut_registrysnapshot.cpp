@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "common/registryformat.h"
+#include "registrysnapshot.h"
+#include <gtest/gtest.h>
+#include <QFile>
+#include <QTemporaryDir>
+#include <cstring>
+
+namespace {
+template <typename T>
+T readAt(const QByteArray &data, quint64 offset)
+{
+    T ret{};
+    std::memcpy(&ret, data.constData() + offset, sizeof(T));
+    return ret;
+}
+
+QByteArray stringAt(const QByteArray &data, const RegistryFormat::Header &header, RegistryFormat::StringRef ref)
+{
+    EXPECT_LT(quint64{ref.offset} + ref.size, header.stringsSize);
+    EXPECT_EQ(data.at(static_cast<qsizetype>(header.stringsOffset + ref.offset + ref.size)), '\0');
+    return data.sliced(static_cast<qsizetype>(header.stringsOffset + ref.offset), ref.size);
+}
+}  // namespace
+
+TEST(RegistrySnapshot, layout)
+{
+    const QList<RegistrySnapshot::Application> apps{
+        {"org.deepin.b", "/org/desktopspec/ApplicationManager1/b", "乙", "", "b", {"Utility"}, "b %U", true, false},
+        {"org.deepin.a", "/org/desktopspec/ApplicationManager1/a", "A", "Editor", "a", {"Development", "Utility"}, "a", false, true},
+    };
+
+    const auto data = RegistrySnapshot::serialize(apps, 42, "zh_CN");
+    ASSERT_GE(data.size(), static_cast<qsizetype>(sizeof(RegistryFormat::Header)));
+
+    const auto header = readAt<RegistryFormat::Header>(data, 0);
+    EXPECT_EQ(std::memcmp(header.magic, RegistryFormat::Magic, sizeof(header.magic)), 0);
+    EXPECT_EQ(header.version, RegistryFormat::Version);
+    EXPECT_EQ(header.generation, 42U);
+    EXPECT_EQ(header.recordSize, sizeof(RegistryFormat::Record));
+    ASSERT_EQ(header.recordCount, 2U);
+    EXPECT_EQ(header.stringsOffset + header.stringsSize, static_cast<quint64>(data.size()));
+    EXPECT_EQ(stringAt(data, header, header.locale), "zh_CN");
+
+    // records are sorted by ID.
+    const auto first = readAt<RegistryFormat::Record>(data, header.recordsOffset);
+    EXPECT_EQ(stringAt(data, header, first.id), "org.deepin.a");
+    EXPECT_EQ(stringAt(data, header, first.genericName), "Editor");
+    EXPECT_EQ(stringAt(data, header, first.categories), "Development;Utility");
+    EXPECT_EQ(first.flags, RegistryFormat::Terminal);
+
+    const auto second = readAt<RegistryFormat::Record>(data, header.recordsOffset + sizeof(RegistryFormat::Record));
+    EXPECT_EQ(stringAt(data, header, second.id), "org.deepin.b");
+    EXPECT_EQ(QString::fromUtf8(stringAt(data, header, second.name)), QString{"乙"});
+    EXPECT_EQ(stringAt(data, header, second.genericName), "");
+    EXPECT_EQ(stringAt(data, header, second.exec), "b %U");
+    EXPECT_EQ(second.flags, RegistryFormat::NoDisplay);
+}
+
+TEST(RegistrySnapshot, write)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto path = dir.filePath("runtime/registry");
+    const auto first = RegistrySnapshot::serialize({}, 1, "en_US");
+    ASSERT_TRUE(RegistrySnapshot::write(path, first));
+
+    QFile old{path};
+    ASSERT_TRUE(old.open(QFile::ReadOnly));
+    const auto *mapped = old.map(0, old.size());
+    ASSERT_NE(mapped, nullptr);
+
+    const auto second = RegistrySnapshot::serialize({{"app", "/app", "App", {}, {}, {}, "app", false, false}}, 2, "en_US");
+    ASSERT_TRUE(RegistrySnapshot::write(path, second));
+
+    // the new snapshot replaced the file, the old mapping still sees the old one.
+    EXPECT_EQ(QByteArray(reinterpret_cast<const char *>(mapped), first.size()), first);
+    QFile current{path};
+    ASSERT_TRUE(current.open(QFile::ReadOnly));
+    EXPECT_EQ(current.readAll(), second);
+}
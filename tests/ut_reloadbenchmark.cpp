@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "cgroupsidentifier.h"
+#include "dbus/applicationmanager1service.h"
+#include "dbus/applicationservice.h"
+#include "desktopidindex.h"
+#include "global.h"
+#include <gtest/gtest.h>
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QStringBuilder>
+#include <QTemporaryDir>
+#include <cstdio>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+// Run with --gtest_also_run_disabled_tests --gtest_filter='ReloadBenchmark.*'
+constexpr int ApplicationCount = 10000;
+constexpr int AppsPerDirectory = 500;
+
+QString desktopPath(const QString &root, int index)
+{
+    return root % u"/vendor-"_s % QString::number(index / AppsPerDirectory) % u"/app-"_s % QString::number(index) %
+           u".desktop"_s;
+}
+
+bool writeApplication(const QString &path, int index, int revision)
+{
+    const auto content = QStringLiteral("[Desktop Entry]\n"
+                                        "Type=Application\n"
+                                        "Name=Application %1\n"
+                                        "Name[zh_CN]=应用 %1\n"
+                                        "Comment=Revision %2\n"
+                                        "Exec=/usr/bin/app-%1 %U\n"
+                                        "Icon=app-%1\n"
+                                        "Categories=Utility;\n"
+                                        "MimeType=text/plain;text/x-app-%1;\n"
+                                        "Actions=new;\n"
+                                        "\n"
+                                        "[Desktop Action new]\n"
+                                        "Name=New Window\n"
+                                        "Exec=/usr/bin/app-%1 --new\n")
+                             .arg(index)
+                             .arg(revision)
+                             .toUtf8();
+
+    QFile file{path};
+    if (!file.open(QFile::WriteOnly | QFile::Truncate) || file.write(content) != content.size()) {
+        return false;
+    }
+
+    // make sure the stat signature changes even if the file is rewritten within the timestamp granularity.
+    return file.setFileTime(QDateTime::currentDateTime().addSecs(revision), QFileDevice::FileModificationTime);
+}
+}  // namespace
+
+TEST(ReloadBenchmark, DISABLED_fullReload)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    const auto root = dir.filePath(u"applications"_s);
+    for (int i = 0; i < ApplicationCount; ++i) {
+        const auto path = desktopPath(root, i);
+        ASSERT_TRUE(QDir{}.mkpath(QFileInfo{path}.absolutePath()));
+        ASSERT_TRUE(writeApplication(path, i, 0));
+    }
+
+    ApplicationManager1Service am{std::make_unique<CGroupsIdentifier>(), {}, dir.filePath(u"desktop-entries.cache"_s)};
+
+    // registering objects needs a bus, so the initial applications are inserted directly.
+    for (int i = 0; i < ApplicationCount; ++i) {
+        const auto path = desktopPath(root, i);
+        const auto desktopId = u"vendor-%1-app-%2"_s.arg(i / AppsPerDirectory).arg(i);
+        auto file = DesktopFile::createDesktopFile(QFileInfo{path}, desktopId);
+        ASSERT_TRUE(file.has_value());
+
+        auto app = ApplicationService::createApplicationService(std::move(file).value(), &am, {});
+        ASSERT_FALSE(app.isNull());
+        am.m_applicationList.insert(app->id(), app);
+    }
+    ASSERT_TRUE(am.m_entryCache.save());
+
+    int revision{0};
+    for (int changed : {0, 1, 100}) {
+        ++revision;
+        for (int i = 0; i < changed; ++i) {
+            const auto index = i * (ApplicationCount / changed);
+            ASSERT_TRUE(writeApplication(desktopPath(root, index), index, revision));
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        am.reloadApplicationsFrom({root});
+        const auto elapsed = timer.nsecsElapsed();
+
+        EXPECT_EQ(am.m_applicationList.size(), ApplicationCount);
+        std::printf("reload %d applications with %d changed files: %.3f ms\n",
+                    ApplicationCount,
+                    changed,
+                    static_cast<double>(elapsed) / 1e6);
+    }
+
+    const auto changedApp = am.m_applicationList.value(u"vendor-0-app-0"_s);
+    ASSERT_FALSE(changedApp.isNull());
+    EXPECT_EQ(toString(changedApp->m_entry->value(u"Desktop Entry"_s, u"Comment"_s)->get()),
+              u"Revision %1"_s.arg(revision));
+
+    // the reload filled the process-wide index with the generated tree.
+    EXPECT_EQ(DesktopIdIndex::instance().size(), ApplicationCount);
+    DesktopIdIndex::instance().clear();
+}
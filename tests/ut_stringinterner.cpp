@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopentry.h"
+#include "stringinterner.h"
+#include <gtest/gtest.h>
+#include <QTemporaryFile>
+
+using namespace Qt::StringLiterals;
+
+TEST(StringInterner, sharesStorage)
+{
+    auto &interner = StringInterner::instance();
+
+    const auto first = interner.intern(QByteArrayView{"X-Test-Interned-Key"});
+    const auto second = interner.intern(QByteArrayView{"X-Test-Interned-Key"});
+    const auto third = interner.intern(u"X-Test-Interned-Key"_s);
+
+    EXPECT_EQ(first, u"X-Test-Interned-Key"_s);
+    EXPECT_EQ(first.constData(), second.constData());
+    EXPECT_EQ(first.constData(), third.constData());
+}
+
+TEST(StringInterner, parsedKeysAreShared)
+{
+    constexpr auto &content = "[Desktop Entry]\nName=A\nName[zh_CN]=B\nType=Application\n";
+
+    auto parse = [&content](DesktopEntry &entry) {
+        QTemporaryFile file;
+        ASSERT_TRUE(file.open());
+        ASSERT_GT(file.write(content), 0);
+        ASSERT_TRUE(file.seek(0));
+        ASSERT_EQ(entry.parse(file), ParserError::NoError);
+    };
+
+    DesktopEntry lhs;
+    DesktopEntry rhs;
+    parse(lhs);
+    parse(rhs);
+
+    const auto &lhsGroup = lhs.data().constFirst();
+    const auto &rhsGroup = rhs.data().constFirst();
+    EXPECT_EQ(lhs.data().firstKey().constData(), rhs.data().firstKey().constData());
+    EXPECT_EQ(lhsGroup.firstKey().constData(), rhsGroup.firstKey().constData());
+
+    const auto lhsNames = lhsGroup.value(u"Name"_s).value<QStringMap>();
+    const auto rhsNames = rhsGroup.value(u"Name"_s).value<QStringMap>();
+    EXPECT_EQ(lhsNames.lastKey().constData(), rhsNames.lastKey().constData());
+}
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "desktopentry.h"
+#include "iniParser.h"
+#include "textkernels.h"
+#include <gtest/gtest.h>
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <random>
+
+using namespace TextKernels;
+
+namespace {
+// lengths around the vector widths, so both the vector loops and the scalar tails are covered.
+constexpr qsizetype MaxLength = 130;
+constexpr int Rounds = 2000;
+
+QList<Isa> vectorIsas()
+{
+    QList<Isa> ret;
+    for (auto isa : {Isa::SSE2, Isa::AVX2}) {
+        if (isSupported(isa)) {
+            ret.append(isa);
+        }
+    }
+    return ret;
+}
+
+QByteArray randomBytes(std::mt19937 &rng, qsizetype size)
+{
+    // bias towards the characters the kernels look for.
+    constexpr auto &interesting = "azAZ09-=[]\\;\n\r #\x7f\x80\xff\x1f";
+    QByteArray ret{size, Qt::Uninitialized};
+    for (auto &ch : ret) {
+        ch = (rng() % 4 != 0) ? interesting[rng() % (sizeof(interesting) - 1)] : static_cast<char>(rng());
+    }
+    return ret;
+}
+
+QString randomString(std::mt19937 &rng, qsizetype size)
+{
+    QString ret{size, Qt::Uninitialized};
+    for (auto &ch : ret) {
+        ch = (rng() % 8 != 0) ? QChar{static_cast<char16_t>(u' ' + rng() % 95)} : QChar{static_cast<char16_t>(rng() % 0x200)};
+    }
+    return ret;
+}
+}  // namespace
+
+TEST(TextKernels, indexOfByte)
+{
+    const auto &scalar = kernels(Isa::Scalar);
+    std::mt19937 rng{1};
+    for (auto isa : vectorIsas()) {
+        const auto &vector = kernels(isa);
+        for (int round = 0; round < Rounds; ++round) {
+            const auto data = randomBytes(rng, rng() % MaxLength);
+            for (auto ch : {'\n', '=', '[', ';', '\\', '\xff'}) {
+                EXPECT_EQ(vector.indexOfByte(data.constData(), data.size(), ch),
+                          scalar.indexOfByte(data.constData(), data.size(), ch))
+                    << "isa:" << static_cast<int>(isa) << " data:" << data.toHex().toStdString();
+            }
+        }
+    }
+}
+
+TEST(TextKernels, keyCharset)
+{
+    const auto &scalar = kernels(Isa::Scalar);
+    std::mt19937 rng{2};
+    for (auto isa : vectorIsas()) {
+        const auto &vector = kernels(isa);
+        for (int round = 0; round < Rounds; ++round) {
+            const auto data = randomBytes(rng, rng() % MaxLength);
+            EXPECT_EQ(vector.indexOfInvalidKeyChar(data.constData(), data.size()),
+                      scalar.indexOfInvalidKeyChar(data.constData(), data.size()))
+                << "isa:" << static_cast<int>(isa) << " data:" << data.toHex().toStdString();
+        }
+
+        // every byte value at a position inside a vector and inside the tail.
+        for (int value = 0; value < 256; ++value) {
+            for (auto pos : {5, 37}) {
+                QByteArray key{40, 'k'};
+                key[pos] = static_cast<char>(value);
+                EXPECT_EQ(vector.indexOfInvalidKeyChar(key.constData(), key.size()),
+                          scalar.indexOfInvalidKeyChar(key.constData(), key.size()))
+                    << "isa:" << static_cast<int>(isa) << " byte:" << value << " pos:" << pos;
+            }
+        }
+    }
+
+    EXPECT_TRUE(isValidKey("X-Deepin-Vendor"));
+    EXPECT_FALSE(isValidKey("X_Deepin_Vendor"));
+    EXPECT_FALSE(isValidKey("Name\r"));
+}
+
+TEST(TextKernels, indexOfChar)
+{
+    const auto &scalar = kernels(Isa::Scalar);
+    std::mt19937 rng{3};
+    for (auto isa : vectorIsas()) {
+        const auto &vector = kernels(isa);
+        for (int round = 0; round < Rounds; ++round) {
+            const auto str = randomString(rng, rng() % MaxLength);
+            for (auto ch : {u'\\', u'a', u'Ā'}) {
+                EXPECT_EQ(vector.indexOfChar(str.utf16(), str.size(), ch), scalar.indexOfChar(str.utf16(), str.size(), ch))
+                    << "isa:" << static_cast<int>(isa) << " str:" << str.toStdString();
+            }
+        }
+    }
+}
+
+TEST(TextKernels, classify)
+{
+    const auto &scalar = kernels(Isa::Scalar);
+    std::mt19937 rng{4};
+    for (auto isa : vectorIsas()) {
+        const auto &vector = kernels(isa);
+        for (int round = 0; round < Rounds; ++round) {
+            const auto str = randomString(rng, rng() % MaxLength);
+            EXPECT_EQ(vector.classify(str.utf16(), str.size()), scalar.classify(str.utf16(), str.size()))
+                << "isa:" << static_cast<int>(isa) << " str:" << str.toStdString();
+        }
+
+        for (char16_t unit = 0; unit < 0x200; ++unit) {
+            for (auto pos : {3, 21}) {
+                QString str{24, u'a'};
+                str[pos] = QChar{unit};
+                EXPECT_EQ(vector.classify(str.utf16(), str.size()), scalar.classify(str.utf16(), str.size()))
+                    << "isa:" << static_cast<int>(isa) << " unit:" << unit << " pos:" << pos;
+            }
+        }
+    }
+
+    EXPECT_FALSE(hasNonAsciiAndControlCharacters(u"Desktop Entry"));
+    EXPECT_FALSE(hasNonAsciiAndControlCharacters(u"文本编辑器"));
+    EXPECT_TRUE(hasNonAsciiAndControlCharacters(u"文本\u0085编辑器"));
+}
+
+TEST(TextKernels, unescapeMatchesScalar)
+{
+    auto scalarUnescape = [](QStringView str) {
+        QString out;
+        for (const auto *it = str.begin(); it != str.end(); ++it) {
+            if (*it == u'\\' && (it + 1) != str.end()) {
+                const auto next = (*(++it)).unicode();
+                switch (next) {
+                case 's':
+                    out.append(u' ');
+                    break;
+                case 'n':
+                    out.append(u'\n');
+                    break;
+                case 't':
+                    out.append(u'\t');
+                    break;
+                case 'r':
+                    out.append(u'\r');
+                    break;
+                case '\\':
+                    out.append(u'\\');
+                    break;
+                case ';':
+                    out.append(u';');
+                    break;
+                default:
+                    out.append(u'\\');
+                    out.append(QChar{next});
+                    break;
+                }
+            } else {
+                out.append(*it);
+            }
+        }
+        return out;
+    };
+
+    std::mt19937 rng{5};
+    constexpr auto &alphabet = u"ab\\snrt;\\\\ ";
+    for (int round = 0; round < Rounds; ++round) {
+        QString str{static_cast<qsizetype>(rng() % MaxLength), Qt::Uninitialized};
+        for (auto &ch : str) {
+            ch = QChar{alphabet[rng() % (std::size(alphabet) - 1)]};
+        }
+        EXPECT_EQ(unescapeValue(str), scalarUnescape(str)) << "str:" << str.toStdString();
+    }
+}
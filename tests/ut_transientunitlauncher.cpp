@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "transientunitlauncher.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+namespace {
+QVariant propertyValue(const TransientUnitLauncher::Request &request, const QString &name)
+{
+    for (const auto &prop : request.properties) {
+        if (prop.name == name) {
+            return prop.value.variant();
+        }
+    }
+    return {};
+}
+
+qsizetype propertyCount(const TransientUnitLauncher::Request &request, const QString &name)
+{
+    return std::count_if(request.properties.cbegin(), request.properties.cend(), [&name](const SystemdProperty &prop) {
+        return prop.name == name;
+    });
+}
+}  // namespace
+
+TEST(TransientUnitLauncher, encodeArgument)
+{
+    EXPECT_EQ(TransientUnitLauncher::encodeArgument(u"/usr/bin/app"_s), u"/usr/bin/app"_s);
+    EXPECT_EQ(TransientUnitLauncher::encodeArgument(u"$HOME/a$b"_s), u"$$HOME/a$$b"_s);
+    EXPECT_EQ(TransientUnitLauncher::encodeArgument(u";"_s), uR"(\;)"_s);
+    EXPECT_EQ(TransientUnitLauncher::encodeArgument(u"a;b"_s), u"a;b"_s);
+    EXPECT_EQ(TransientUnitLauncher::encodeArgument(u"%f"_s), u"%f"_s);
+}
+
+TEST(TransientUnitLauncher, parseCommandLine)
+{
+    const QStringList commandLine{u"--unitName=app-DDE-test@1234.service"_s,
+                                  u"--SyslogIdentifier=test"_s,
+                                  u"--SourcePath=/usr/share/applications/test.desktop"_s,
+                                  u"--Type=simple"_s,
+                                  u"--Environment=A=1"_s,
+                                  u"--Environment=B=2"_s,
+                                  u"--ExecSearchPath=/usr/bin/../local/bin"_s,
+                                  u"--ExecSearchPath=relative/bin"_s,
+                                  u"--WorkingDirectory=/tmp"_s,
+                                  u"--"_s,
+                                  u"/usr/bin/test"_s,
+                                  u"--price=$5"_s,
+                                  u";"_s};
+
+    const auto request = TransientUnitLauncher::parseCommandLine(commandLine);
+    ASSERT_TRUE(request.has_value());
+    EXPECT_EQ(request->unitName, u"app-DDE-test@1234.service"_s);
+
+    // the type can't be overridden by the command line.
+    EXPECT_EQ(propertyCount(*request, u"Type"_s), 1);
+    EXPECT_EQ(propertyValue(*request, u"Type"_s).toString(), u"exec"_s);
+    EXPECT_EQ(propertyValue(*request, u"ExitType"_s).toString(), u"cgroup"_s);
+    EXPECT_EQ(propertyValue(*request, u"Slice"_s).toString(), u"app.slice"_s);
+    EXPECT_EQ(propertyValue(*request, u"CollectMode"_s).toString(), u"inactive-or-failed"_s);
+    EXPECT_EQ(propertyValue(*request, u"SyslogIdentifier"_s).toString(), u"test"_s);
+    EXPECT_EQ(propertyValue(*request, u"SourcePath"_s).toString(), u"/usr/share/applications/test.desktop"_s);
+    EXPECT_EQ(propertyValue(*request, u"WorkingDirectory"_s).metaType(), QMetaType::fromType<QString>());
+
+    // repeated keys are collected into one array.
+    EXPECT_EQ(propertyCount(*request, u"Environment"_s), 1);
+    EXPECT_EQ(propertyValue(*request, u"Environment"_s).toStringList(), (QStringList{u"A=1"_s, u"B=2"_s}));
+    EXPECT_EQ(propertyValue(*request, u"ExecSearchPath"_s).toStringList(), QStringList{u"/usr/local/bin"_s});
+
+    const auto execStart = propertyValue(*request, u"ExecStart"_s).value<QList<SystemdExecCommand>>();
+    ASSERT_EQ(execStart.size(), 1);
+    EXPECT_EQ(execStart.first().path, u"/usr/bin/test"_s);
+    EXPECT_EQ(execStart.first().args, (QStringList{u"/usr/bin/test"_s, u"--price=$$5"_s, uR"(\;)"_s}));
+    EXPECT_FALSE(execStart.first().unclean);
+}
+
+TEST(TransientUnitLauncher, parseInvalidCommandLine)
+{
+    // no unit name.
+    EXPECT_FALSE(TransientUnitLauncher::parseCommandLine({u"--"_s, u"/usr/bin/test"_s}).has_value());
+    // nothing to execute.
+    EXPECT_FALSE(TransientUnitLauncher::parseCommandLine({u"--unitName=test.service"_s, u"--"_s}).has_value());
+    // options must come before "--".
+    EXPECT_FALSE(TransientUnitLauncher::parseCommandLine({u"--unitName=test.service"_s, u"/usr/bin/test"_s}).has_value());
+    EXPECT_FALSE(
+        TransientUnitLauncher::parseCommandLine({u"--unitName=test.service"_s, u"--=value"_s, u"--"_s, u"/usr/bin/test"_s})
+            .has_value());
+}
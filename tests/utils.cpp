@@ -2,13 +2,90 @@
 //
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
+#include "utils.h"
 #include "global.h"
+#include <QDBusConnection>
+#include <QFile>
+#include <QFileInfo>
 
 bool registerObjectToDBus(QObject *, const QString &, const QString &) noexcept
 {
     return true;
 }
 
+bool registerVirtualObjectToDBus(QDBusVirtualObject *, const QString &) noexcept
+{
+    return true;
+}
+
 void unregisterObjectFromDBus(const QString &) noexcept
 {
 }
+
+void ApplicationManagerTest::SetUpTestSuite()
+{
+    if (hasSessionBus()) {
+        ApplicationManager1DBus::instance().initGlobalServerBus(DBusType::Session);
+    }
+}
+
+void ApplicationManagerTest::SetUp()
+{
+    ASSERT_TRUE(m_dir.isValid());
+}
+
+bool ApplicationManagerTest::hasSessionBus() noexcept
+{
+    return QDBusConnection::sessionBus().isConnected();
+}
+
+bool ApplicationManagerTest::writeFile(const QString &path, const QByteArray &content) noexcept
+{
+    QFile file{path};
+    return file.open(QFile::WriteOnly | QFile::Truncate) && file.write(content) == content.size();
+}
+
+std::unique_ptr<DesktopEntry> ApplicationManagerTest::parseEntry(const QString &path) noexcept
+{
+    auto file = DesktopFile::createDesktopFile(QFileInfo{path}, QFileInfo{path}.completeBaseName());
+    if (!file) {
+        return nullptr;
+    }
+
+    auto entry = std::make_unique<DesktopEntry>();
+    if (entry->parse(file.value()) != ParserError::NoError) {
+        return nullptr;
+    }
+    return entry;
+}
+
+QString ApplicationManagerTest::desktopFilePath(const QString &appId) const
+{
+    return m_dir.filePath(appId + ".desktop");
+}
+
+QSharedPointer<ApplicationService> ApplicationManagerTest::addApplication(const QString &appId, const QByteArray &content)
+{
+    const auto path = desktopFilePath(appId);
+    if (!writeFile(path, content)) {
+        return nullptr;
+    }
+
+    auto file = DesktopFile::createDesktopFile(QFileInfo{path}, appId);
+    if (!file) {
+        return nullptr;
+    }
+
+    auto app = ApplicationService::createApplicationService(std::move(file).value(), &m_am, m_storage);
+    if (!app.isNull()) {
+        m_am.m_applicationList.insert(app->id(), app);
+    }
+    return app;
+}
+
+void ApplicationManagerTest::reload(const QStringList &dirs)
+{
+    m_am.beginReloadTransaction();
+    m_am.reloadApplicationsFrom(QStringList{m_dir.path()} + dirs);
+    m_am.finishReloadTransaction();
+}
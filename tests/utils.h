@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef UT_UTILS_H
+#define UT_UTILS_H
+
+#include "cgroupsidentifier.h"
+#include "dbus/applicationmanager1service.h"
+#include "dbus/applicationservice.h"
+#include "desktopentry.h"
+#include <gtest/gtest.h>
+#include <QSharedPointer>
+#include <QTemporaryDir>
+#include <memory>
+
+// An application manager without storage whose desktop files and entry cache live in a temporary directory.
+class ApplicationManagerTest : public testing::Test
+{
+public:
+    // a reload announces the applications it changed on the server bus, it's the session bus if there is one.
+    static void SetUpTestSuite();
+
+protected:
+    void SetUp() override;
+
+    [[nodiscard]] static bool hasSessionBus() noexcept;
+    [[nodiscard]] static bool writeFile(const QString &path, const QByteArray &content) noexcept;
+    // nullptr if path can't be parsed.
+    [[nodiscard]] static std::unique_ptr<DesktopEntry> parseEntry(const QString &path) noexcept;
+
+    [[nodiscard]] QString desktopFilePath(const QString &appId) const;
+    // writes $appId.desktop and adds its application to the manager, nullptr if it can't be created.
+    QSharedPointer<ApplicationService> addApplication(const QString &appId, const QByteArray &content);
+    // rescans the directory and every one of dirs as one reload.
+    void reload(const QStringList &dirs = {});
+
+    QTemporaryDir m_dir;
+    std::shared_ptr<ApplicationManager1Storage> m_storage{nullptr};
+    ApplicationManager1Service m_am{std::make_unique<CGroupsIdentifier>(), m_storage, m_dir.filePath("desktop-entries.cache")};
+};
+
+#endif